@@ -0,0 +1,214 @@
+/**
+ ******************************************************************************
+ * @file     bench.c
+ * @brief    Cycle benchmark of the EV1527 decoder on the INT0 backend
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     Wiring (ATmega328P, 16MHz): one jumper from PD3 (OC2B, Arduino D3)
+ *           to PD2 (INT0, Arduino D2). The report goes out on TXD (PD1) at
+ *           57600 8N1.
+ *
+ * @note     Every round sends one code BENCH_Repeats times with
+ *           ev1527_Transmit() on Timer2/OC2B, then BENCH_Broken frames that
+ *           are cut by an invalid bit, bit-banged on the same pin. The
+ *           decoder runs in the INT0 ISR exactly as in a receiver, timed with
+ *           EV_Bench_Timer0 (Timer0 /1 + Timer1): single CPU cycles.
+ *
+ * @note     Report, after every BENCH_Rounds rounds:
+ *             path      calls    min    avg    max   (CPU cycles)
+ *           Preamble, Bit, Frame (last bit + publish), Abort (frame reset),
+ *           High and Hunt, then the number of frames read back.
+ ******************************************************************************
+ */
+#include "aKaReZa.h"
+#include "ev1527.h"
+#include <util/delay.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !EV_Bench_Enable || !EV_Tx_Enable || (EV_Tx_Output != EV_Tx_OC2B) || (EV_Capture_Mode != EV_Capture_INT0)
+    #error "Build with the Makefile: EV_Bench_Enable, EV_Tx_Enable, EV_Tx_Output=EV_Tx_OC2B, EV_Capture_INT0"
+#endif
+
+
+/* ============================================================================
+ *                         BENCHMARK PARAMETERS
+ * ============================================================================ */
+
+#define BENCH_Rounds   25                /**< Rounds per report */
+#define BENCH_Repeats  6                 /**< Valid frames per round, fewer than EV_Queue_Size */
+#define BENCH_Broken   4                 /**< Aborted frames per round (bit-banged) */
+#define BENCH_Cut      8                 /**< Valid bits before the invalid one */
+#define BENCH_Gap_ms   30                /**< Silence between rounds */
+
+#define BENCH_Baud     57600UL
+#define BENCH_UBRR     ((F_CPU / (8UL * BENCH_Baud)) - 1)  /**< U2X: 34 at 16MHz, -0.8% */
+
+#define BENCH_T_us     EV_Tx_T_us        /**< Base period of the bit-banged frames */
+
+static const char benchNames[EV_Path_Count][9] =
+{
+  "High", "Hunt", "Preamble", "Bit", "Frame", "Abort"
+};
+
+
+/* ============================================================================
+ *                         UART REPORT
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Initialize USART0, transmitter only
+ * @retval None
+ * ------------------------------------------------------- */
+static void benchUartInit(void)
+{
+  UBRR0 = BENCH_UBRR;
+  UCSR0A = (1 << U2X0);                                    /**< Double speed: smaller baud error at 16MHz */
+  UCSR0B = (1 << TXEN0);
+  UCSR0C = (1 << UCSZ01) | (1 << UCSZ00);                  /**< 8N1 */
+};
+
+/* -------------------------------------------------------
+ * @brief Send one byte (busy wait)
+ * @param _Byte: Byte to send
+ * @retval None
+ * ------------------------------------------------------- */
+static void benchPut(uint8_t _Byte)
+{
+  while(!bitCheck(UCSR0A, UDRE0));
+  UDR0 = _Byte;
+};
+
+/* -------------------------------------------------------
+ * @brief Send a string
+ * @param _Text: NUL terminated string
+ * @retval None
+ * ------------------------------------------------------- */
+static void benchText(const char *_Text)
+{
+  while(*_Text) benchPut(*_Text++);
+};
+
+/* -------------------------------------------------------
+ * @brief Send a number right aligned in a column
+ * @param _Value: Number
+ * @param _Width: Column width
+ * @retval None
+ * ------------------------------------------------------- */
+static void benchNumber(uint32_t _Value, uint8_t _Width)
+{
+  char _Digits[11];
+  ultoa(_Value, _Digits, 10);
+  for(uint8_t _Len = strlen(_Digits); _Len < _Width; _Len++) benchPut(' ');
+  benchText(_Digits);
+};
+
+/* -------------------------------------------------------
+ * @brief Print and clear the measurement of every path
+ * @param _Sent: Valid frames sent since the last report
+ * @param _Read: Frames read back since the last report
+ * @retval None
+ * ------------------------------------------------------- */
+static void benchReport(uint16_t _Sent, uint16_t _Read)
+{
+  ev1527_Bench_T _b;
+
+  benchText("\r\npath        calls    min    avg    max  (cycles, F_CPU=");
+  benchNumber(F_CPU, 0);
+  benchText(")\r\n");
+  for(uint8_t _Path = 0; _Path < EV_Path_Count; _Path++)
+  {
+    ev1527_GetBench(_Path, &_b, true);
+    benchText(benchNames[_Path]);
+    benchNumber(_b.Count, 16 - strlen(benchNames[_Path]));
+    benchNumber(_b.Min, 7);
+    benchNumber(_b.Count ? (_b.Sum / _b.Count) : 0, 7);
+    benchNumber(_b.Max, 7);
+    benchText("\r\n");
+  };
+  benchText("frames ");
+  benchNumber(_Read, 0);
+  benchPut('/');
+  benchNumber(_Sent, 0);
+  benchText("\r\n");
+};
+
+
+/* ============================================================================
+ *                         TEST SIGNAL
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Bit-bang one pulse pair on PD3
+ * @param _High_T: HIGH length in T
+ * @param _Low_T: LOW length in T
+ * @retval None
+ * @note The INT0 ISR stretches the delays by its own run time; the
+ *       decoder tolerates far more than that
+ * ------------------------------------------------------- */
+#define benchPair(_High_T, _Low_T)  do { bitSet(PORTD, 3); _delay_us((_High_T) * BENCH_T_us); bitClear(PORTD, 3); _delay_us((_Low_T) * BENCH_T_us); } while(0)
+
+/* -------------------------------------------------------
+ * @brief Send a frame that is cut by an invalid bit
+ * @retval None
+ * @note Preamble, BENCH_Cut alternating bits, then HIGH T + LOW 16T:
+ *       the pair is longer than EV_Pulse_Max_us (Abort path) and too short
+ *       for a preamble
+ * ------------------------------------------------------- */
+static void benchBroken(void)
+{
+  benchPair(1, 31);                                        /**< Preamble */
+  for(uint8_t _Bit = 0; _Bit < BENCH_Cut; _Bit++)
+  {
+    if(_Bit & 0x01) benchPair(3, 1);                       /**< '1' */
+    else benchPair(1, 3);                                  /**< '0' */
+  };
+  benchPair(1, 16);                                        /**< Invalid bit */
+};
+
+
+/* ============================================================================
+ *                         MAIN
+ * ============================================================================ */
+
+int main(void)
+{
+  ev1527_T _Code;
+  ev1527_T _Tx;
+  uint16_t _Sent = 0;
+  uint16_t _Read = 0;
+
+  benchUartInit();
+  bitClear(PORTD, 3);                                      /**< Loop-back line idles LOW */
+  GPIO_Config_OUTPUT(DDRD, 3);
+  ev1527_Init();                                           /**< INT0 on PD2 + Timer1, Timer0 /1 (EV_Bench_Timer0) */
+  sei();
+  benchText("\r\nEV1527 decoder benchmark, PD3 -> PD2\r\n");
+
+  _Tx.rawValue = 0;
+  _Tx.Bits.Address = 0x5A3C9;
+  while(1)
+  {
+    for(uint8_t _Round = 0; _Round < BENCH_Rounds; _Round++)
+    {
+      _Tx.Bits.Keys = _Round & 0x0F;                       /**< A new code every round */
+      ev1527_Transmit(_Tx, BENCH_Repeats);
+      while(ev1527_TxBusy());
+      _Sent += BENCH_Repeats;
+
+      for(uint8_t _n = 0; _n < BENCH_Broken; _n++) benchBroken();  /**< First edge also ends the last transmitted LOW */
+      benchPair(1, 0);                                     /**< Closing edge: the last invalid LOW is decoded now */
+      _delay_ms(BENCH_Gap_ms);
+
+      while(ev1527_Read(&_Code))
+      {
+        if(EV_Code_Frame(_Code) == EV_Code_Frame(_Tx)) _Read++;
+      };
+    };
+    benchReport(_Sent, _Read);
+    _Sent = 0;
+    _Read = 0;
+  };
+};
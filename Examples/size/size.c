@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * @file     size.c
+ * @brief    Smallest receiver application, linked by size_report.sh
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     Uses the entry points of the enabled features, so that
+ *           --gc-sections keeps the code a real receiver would link. The
+ *           flash figure also holds the vector table (104 bytes on the
+ *           ATmega328P), the C runtime start-up and this main.
+ ******************************************************************************
+ */
+#include "aKaReZa.h"
+#include "ev1527.h"
+
+#if EV_Callback_Enable
+static volatile uint8_t sizeKeys;
+
+static void sizeHandler(ev1527_T _Code)
+{
+  sizeKeys = EV_Code_Keys(_Code);
+};
+#endif
+
+int main(void)
+{
+  ev1527_T _Code;
+
+  GPIO_Config_OUTPUT(DDRB, 5);
+  ev1527_Init();
+#if EV_Callback_Enable
+  ev1527_OnFrame(sizeHandler);
+#endif
+#if EV_Whitelist_Enable
+  ev1527_LearnNext(true);
+#endif
+  sei();
+
+  while(1)
+  {
+    ev1527_Process();
+#if EV_Queue_Enable
+    if(ev1527_Read(&_Code))
+#else
+    if(ev1527_Take(&_Code))
+#endif
+    {
+      PORTB = EV_Code_Keys(_Code);
+#if EV_Tx_Enable
+      ev1527_Transmit(_Code, 4);                           /**< Repeater */
+#endif
+    };
+  };
+};
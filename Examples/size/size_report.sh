@@ -0,0 +1,43 @@
+#!/bin/sh
+# Flash and SRAM of the EV1527 library per build configuration
+#
+#   Examples/size/size_report.sh [aKaReZa.h directory]
+#
+# Builds Examples/size/size.c with every configuration below (avr-gcc -Os,
+# --gc-sections, ATmega328P, 16MHz) and prints the Program (flash) and
+# Data (static SRAM: .data + .bss) figures of avr-size -C. Stack use is not
+# included. Add a line to ROWS to measure another configuration.
+
+AKAREZA=${1:-${AKAREZA:-../aKaReZa}}
+MCU=atmega328p
+HERE=$(cd "$(dirname "$0")" && pwd)
+SRC="$HERE/../../Sources"
+OUT=${TMPDIR:-/tmp}/ev1527_size.$$
+CFLAGS="-mmcu=$MCU -DF_CPU=16000000UL -Os -std=gnu99 -ffunction-sections -fdata-sections -Wl,--gc-sections"
+
+ROWS='EV_Profile_Minimal|-DEV_Config_Profile=EV_Profile_Minimal
+EV_Profile_Minimal, EV_Data_Bits 12|-DEV_Config_Profile=EV_Profile_Minimal -DEV_Data_Bits=12 -DEV_Key_Bits=4
+Baseline (default options, 8-entry queue)|
+Baseline + EV_Tx_Enable|-DEV_Tx_Enable=1
+Baseline + EV_Confirm_Enable|-DEV_Confirm_Enable=1
+Baseline + EV_Callback_Enable|-DEV_Callback_Enable=1
+Baseline + EV_Soft_Enable|-DEV_Soft_Enable=1
+Baseline + EV_Stats_Enable|-DEV_Stats_Enable=1
+Baseline + PT2262 + HT12E table|-DEV_Protocol_PT2262=1 -DEV_Protocol_HT12E=1
+Baseline + EV_Stamp_Enable + EV_Gesture_Enable|-DEV_Stamp_Enable=1 -DEV_Gesture_Enable=1
+Baseline + EV_Decode_Deferred|-DEV_Decode_Mode=EV_Decode_Deferred
+Baseline + EV_Whitelist_Enable (32 slots)|-DEV_Whitelist_Enable=1 -DEV_Whitelist_Size=32'
+
+printf '| %-46s | %13s | %19s |\n' 'Configuration' 'Flash (bytes)' 'Static SRAM (bytes)'
+printf '|%s|%s|%s|\n' '------------------------------------------------' '---------------' '---------------------'
+echo "$ROWS" | while IFS='|' read -r _Label _Flags; do
+  if avr-gcc $CFLAGS -I"$AKAREZA" -I"$SRC" $_Flags -o "$OUT.elf" "$HERE/size.c" "$SRC/ev1527.c"; then
+    avr-size -C --mcu=$MCU "$OUT.elf" | awk -v label="$_Label" '
+      /^Program:/ { flash = $2 }
+      /^Data:/    { sram = $2 }
+      END         { printf "| %-46s | %13s | %19s |\n", label, flash, sram }'
+  else
+    printf '| %-46s | %13s | %19s |\n' "$_Label" 'build failed' '-'
+  fi
+done
+rm -f "$OUT.elf"
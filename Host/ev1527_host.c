@@ -0,0 +1,830 @@
+/**
+ ******************************************************************************
+ * @file     ev1527_host.c
+ * @brief    Host test harness for the EV1527 decoder (EV_Capture_Software)
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     Builds Sources/ev1527.c on the PC against the stubs in Host/stub
+ *           and drives it through ev1527_Feed(). Nothing here runs on the AVR.
+ *
+ * @note     Commands:
+ *           - replay <file>... : Decode text traces or ev1527_RawDump() images
+ *           - gen [options]    : Write a synthetic trace to stdout
+ *           - sweep            : Synthetic jitter / drift / glitch / noise sweep
+ *           -l <limits> before replay / sweep checks every row against the
+ *           limits file and makes the exit status 1 when one is missed
+ *
+ * @note     Generator options (gen and the sweep rows):
+ *           -n presses  -r repeats  -t T_us  -j jitter_%  -d drift_%
+ *           -g glitches per 1000 pulses  -i idle noise pulses  -s seed
+ *
+ * @note     Text trace format, one item per line:
+ *           - "H <us>" / "L <us>" : HIGH / LOW pulse width in microseconds
+ *           - "= <hex>"           : The next frame on the line carries this code
+ *           - "# ..."             : Comment
+ *
+ * @note     Reported per trace:
+ *           - frame%  : sent frames decoded with the right code
+ *           - press%  : presses (runs of frames with one code) with at least
+ *                       one frame decoded before the next press starts
+ *           - false   : decoded frames whose code was never sent, and their
+ *                       share of all decoded frames
+ *           - ns/edge : host time of ev1527_Feed() + ev1527_Process() per
+ *                       pulse, for comparing changes; not AVR cycles
+ *
+ * @note     Limits file, one row per line, "-" leaves a column unchecked:
+ *           <min frame%> <min press%> <max false%> <max false> <row name>
+ *           The row name is the trace file name without its directory, or
+ *           the sweep row title.
+ ******************************************************************************
+ */
+
+#include "aKaReZa.h"
+#include "ev1527.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if EV_Capture_Mode != EV_Capture_Software
+    #error "The host harness needs EV_Capture_Mode=EV_Capture_Software"
+#endif
+
+
+/* ============================================================================
+ *                         TRACE
+ * ============================================================================ */
+
+/**
+ * @brief One pulse of a trace
+ */
+typedef struct
+{
+    uint32_t Width_ns;                   /**< Pulse width in nanoseconds */
+    uint8_t Level;                       /**< 1=HIGH, 0=LOW */
+} host_Pulse_T;
+
+/**
+ * @brief Frames sent with one code
+ */
+typedef struct
+{
+    uint32_t Code;                       /**< Frame value (EV_Code_Frame) */
+    uint32_t Sent;                       /**< Frames transmitted with this code */
+    uint32_t Decoded;                    /**< Frames decoded with this code */
+} host_Code_T;
+
+/**
+ * @brief Pulse sequence with the list of codes it carries
+ */
+typedef struct
+{
+    host_Pulse_T *Pulse;
+    size_t Count, Size;
+    host_Code_T *Code;
+    size_t codeCount, codeSize;
+    size_t *Start;                       /**< Index of the first pulse of every sent frame */
+    uint32_t *startCode;                 /**< Code of every sent frame */
+    uint32_t Sent;                       /**< Frames transmitted in total */
+    uint32_t startSize;
+    bool Merge;                          /**< Generator: join consecutive pulses of one level */
+} host_Trace_T;
+
+/**
+ * @brief Result of one decoding run
+ */
+typedef struct
+{
+    uint32_t Sent;
+    uint32_t Correct;                    /**< Decoded frames matching a sent one, at most Sent per code */
+    uint32_t Presses;                    /**< Runs of consecutive frames with one code */
+    uint32_t pressDecoded;               /**< Presses with at least one frame decoded during the press */
+    uint32_t False;                      /**< Decoded frames with a code that was never sent */
+    uint32_t Decoded;
+    double nsPerEdge;
+} host_Result_T;
+
+/**
+ * @brief Pass limits of one report row ("-" in the file = negative, unchecked)
+ */
+typedef struct
+{
+    char Name[40];
+    double minFrame;                     /**< Lowest accepted frame% */
+    double minPress;                     /**< Lowest accepted press% */
+    double maxFalse;                     /**< Highest accepted false% */
+    long maxCount;                       /**< Highest accepted number of false frames */
+} host_Limit_T;
+
+static host_Limit_T hostLimits[64];
+static size_t hostLimitCount = 0;
+static unsigned hostMissed = 0;          /**< Rows that missed a limit */
+
+
+/* -------------------------------------------------------
+ * @brief Append a pulse to the trace
+ * @param _tr: Trace
+ * @param _Level: 1=HIGH, 0=LOW
+ * @param _Width_ns: Width in nanoseconds
+ * @retval None
+ * @note With _tr->Merge, a pulse of the same level as the previous one
+ *       extends it: the line cannot change to the level it already has
+ * ------------------------------------------------------- */
+static void hostPulse(host_Trace_T *_tr, uint8_t _Level, uint32_t _Width_ns)
+{
+  if(_tr->Merge && _tr->Count && (_tr->Pulse[_tr->Count - 1].Level == _Level))
+  {
+    _tr->Pulse[_tr->Count - 1].Width_ns += _Width_ns;
+    return;
+  };
+  if(_tr->Count == _tr->Size)
+  {
+    _tr->Size = _tr->Size ? 2 * _tr->Size : 4096;
+    _tr->Pulse = realloc(_tr->Pulse, _tr->Size * sizeof(host_Pulse_T));
+    if(_tr->Pulse == NULL) { perror("realloc"); exit(1); };
+  };
+  _tr->Pulse[_tr->Count].Width_ns = _Width_ns;
+  _tr->Pulse[_tr->Count].Level = _Level;
+  _tr->Count++;
+};
+
+/* -------------------------------------------------------
+ * @brief Find or add a code in the trace code list
+ * @param _tr: Trace
+ * @param _Code: Frame value
+ * @param _Add: true to add a missing code
+ * @retval Entry, NULL if missing and not added
+ * ------------------------------------------------------- */
+static host_Code_T *hostCode(host_Trace_T *_tr, uint32_t _Code, bool _Add)
+{
+  for(size_t _i = 0; _i < _tr->codeCount; _i++)
+  {
+    if(_tr->Code[_i].Code == _Code) return &_tr->Code[_i];
+  };
+  if(!_Add) return NULL;
+  if(_tr->codeCount == _tr->codeSize)
+  {
+    _tr->codeSize = _tr->codeSize ? 2 * _tr->codeSize : 64;
+    _tr->Code = realloc(_tr->Code, _tr->codeSize * sizeof(host_Code_T));
+    if(_tr->Code == NULL) { perror("realloc"); exit(1); };
+  };
+  host_Code_T *_c = &_tr->Code[_tr->codeCount++];
+  _c->Code = _Code;
+  _c->Sent = 0;
+  _c->Decoded = 0;
+  return _c;
+};
+
+/* -------------------------------------------------------
+ * @brief Record a transmitted frame that starts with the next pulse
+ * @param _tr: Trace
+ * @param _Code: Frame value
+ * @retval None
+ * ------------------------------------------------------- */
+static void hostSent(host_Trace_T *_tr, uint32_t _Code)
+{
+  if(_tr->Sent == _tr->startSize)
+  {
+    _tr->startSize = _tr->startSize ? 2 * _tr->startSize : 256;
+    _tr->Start = realloc(_tr->Start, _tr->startSize * sizeof(size_t));
+    _tr->startCode = realloc(_tr->startCode, _tr->startSize * sizeof(uint32_t));
+    if((_tr->Start == NULL) || (_tr->startCode == NULL)) { perror("realloc"); exit(1); };
+  };
+  _tr->Start[_tr->Sent] = _tr->Count;                      /**< The frame starts with the next pulse */
+  _tr->startCode[_tr->Sent] = _Code;
+  hostCode(_tr, _Code, true)->Sent++;
+  _tr->Sent++;
+};
+
+/* -------------------------------------------------------
+ * @brief Release the trace buffers
+ * @param _tr: Trace
+ * @retval None
+ * ------------------------------------------------------- */
+static void hostFree(host_Trace_T *_tr)
+{
+  free(_tr->Pulse);
+  free(_tr->Code);
+  free(_tr->Start);
+  free(_tr->startCode);
+  memset(_tr, 0, sizeof(*_tr));
+};
+
+/* -------------------------------------------------------
+ * @brief Load an ev1527_RawDump() image
+ * @param _tr: Trace
+ * @param _Data: File contents
+ * @param _Length: File length
+ * @retval true if the header, the length and the CRC are valid
+ * @note Entry bit 0 is the level, the rest is the width in tick_ns units;
+ *       0xFFFE stands for EV_Tick_Overflow. The image carries no codes,
+ *       so only decoded frames are reported.
+ * ------------------------------------------------------- */
+static bool hostLoadRaw(host_Trace_T *_tr, const uint8_t *_Data, size_t _Length)
+{
+  if(_Length < 10) return false;
+  uint16_t _TickNs = _Data[4] | (_Data[5] << 8);
+  uint16_t _Count = _Data[6] | (_Data[7] << 8);
+  if(_Length != (size_t)(10 + 2 * _Count)) return false;
+
+  uint16_t _CRC = 0xFFFF;
+  for(size_t _i = 0; _i < _Length - 2; _i++)
+  {
+    _CRC ^= _Data[_i];
+    for(uint8_t _b = 0; _b < 8; _b++) _CRC = (_CRC & 1) ? ((_CRC >> 1) ^ 0xA001) : (_CRC >> 1);
+  };
+  if(_CRC != (_Data[_Length - 2] | (_Data[_Length - 1] << 8))) return false;
+
+  for(uint16_t _i = 0; _i < _Count; _i++)
+  {
+    uint16_t _Entry = _Data[8 + 2 * _i] | (_Data[9 + 2 * _i] << 8);
+    uint32_t _Width = (uint32_t)(_Entry & 0xFFFE) * _TickNs;
+    if((_Entry & 0xFFFE) == 0xFFFE) _Width = UINT32_MAX;  /**< Saturated in the recording */
+    hostPulse(_tr, _Entry & 0x0001, _Width);
+  };
+  return true;
+};
+
+/* -------------------------------------------------------
+ * @brief Load a text trace or an ev1527_RawDump() image
+ * @param _tr: Trace (empty)
+ * @param _Path: File name
+ * @retval true on success
+ * ------------------------------------------------------- */
+static bool hostLoad(host_Trace_T *_tr, const char *_Path)
+{
+  FILE *_f = fopen(_Path, "rb");
+  if(_f == NULL) { perror(_Path); return false; };
+
+  uint8_t _Magic[3] = { 0 };
+  size_t _Got = fread(_Magic, 1, 3, _f);
+  rewind(_f);
+
+  if((_Got == 3) && (_Magic[0] == 'E') && (_Magic[1] == 'V') && (_Magic[2] == 'R'))
+  {
+    static uint8_t _Image[10 + 2 * 65535];
+    size_t _Length = fread(_Image, 1, sizeof(_Image), _f);
+    fclose(_f);
+    if(!hostLoadRaw(_tr, _Image, _Length)) { fprintf(stderr, "%s: bad raw dump\n", _Path); return false; };
+    return true;
+  };
+
+  char _Line[128];
+  unsigned _LineNo = 0;
+  while(fgets(_Line, sizeof(_Line), _f))
+  {
+    char *_p = _Line;
+    _LineNo++;
+    while((*_p == ' ') || (*_p == '\t')) _p++;
+    if((*_p == '#') || (*_p == '\n') || (*_p == '\r') || (*_p == 0)) continue;
+
+    if((*_p == 'H') || (*_p == 'L'))
+    {
+      hostPulse(_tr, *_p == 'H', (uint32_t)(strtod(_p + 1, NULL) * 1000.0));
+    }
+    else if(*_p == '=')
+    {
+      hostSent(_tr, (uint32_t)strtoul(_p + 1, NULL, 16));
+    }
+    else
+    {
+      fprintf(stderr, "%s:%u: unknown line\n", _Path, _LineNo);
+      fclose(_f);
+      return false;
+    };
+  };
+  fclose(_f);
+  return true;
+};
+
+
+/* ============================================================================
+ *                         SYNTHETIC GENERATOR
+ * ============================================================================ */
+
+/**
+ * @brief Generator settings
+ */
+typedef struct
+{
+    unsigned Presses;                    /**< Button presses, each a new random code */
+    unsigned Repeats;                    /**< Frames per press */
+    unsigned T_us;                       /**< Nominal base period */
+    unsigned Jitter;                     /**< ±% random error of every pulse */
+    unsigned Drift;                      /**< ±% offset of T per press (transmitter clock spread) */
+    unsigned Glitch;                     /**< Glitches per 1000 frame pulses (short pulse of the other level) */
+    unsigned Idle;                       /**< Receiver noise pulses between presses (AGC noise) */
+    uint32_t Seed;
+} host_Gen_T;
+
+static uint32_t hostRandState = 1;
+
+/* -------------------------------------------------------
+ * @brief xorshift32 random number
+ * @retval Next 32-bit value
+ * ------------------------------------------------------- */
+static uint32_t hostRand(void)
+{
+  hostRandState ^= hostRandState << 13;
+  hostRandState ^= hostRandState >> 17;
+  hostRandState ^= hostRandState << 5;
+  return hostRandState;
+};
+
+/* -------------------------------------------------------
+ * @brief Uniform random value in [-1, 1]
+ * ------------------------------------------------------- */
+static double hostUniform(void)
+{
+  return (hostRand() / 2147483647.5) - 1.0;
+};
+
+/* -------------------------------------------------------
+ * @brief Emit one frame pulse with jitter and an optional glitch
+ * @param _tr: Trace
+ * @param _g: Generator settings
+ * @param _Level: Pulse level
+ * @param _Width_us: Ideal width
+ * @retval None
+ * @note A glitch splits the pulse: part, 10-100µs of the other level, rest
+ * ------------------------------------------------------- */
+static void hostGenPulse(host_Trace_T *_tr, const host_Gen_T *_g, uint8_t _Level, double _Width_us)
+{
+  double _Width = _Width_us * (1.0 + hostUniform() * _g->Jitter / 100.0);
+
+  if(_g->Glitch && ((hostRand() % 1000) < _g->Glitch))
+  {
+    double _Spike = 10.0 + (hostRand() % 91);
+    double _Part = _Width * (0.2 + 0.6 * (hostRand() % 1000) / 1000.0);
+    if(_Width > _Part + _Spike)
+    {
+      hostPulse(_tr, _Level, (uint32_t)(_Part * 1000.0));
+      hostPulse(_tr, !_Level, (uint32_t)(_Spike * 1000.0));
+      hostPulse(_tr, _Level, (uint32_t)((_Width - _Part - _Spike) * 1000.0));
+      return;
+    };
+  };
+  hostPulse(_tr, _Level, (uint32_t)(_Width * 1000.0));
+};
+
+/* -------------------------------------------------------
+ * @brief Emit receiver noise between two presses: quiet LOW, random pulses
+ *        of 50-3000µs, quiet LOW
+ * @param _tr: Trace
+ * @param _Count: Noise pulses
+ * @retval None
+ * @note The quiet LOWs (5-20ms) stand for the receiver AGC settling around a
+ *       transmission. The first one also ends the last bit of the previous frame.
+ * ------------------------------------------------------- */
+static void hostGenNoise(host_Trace_T *_tr, unsigned _Count)
+{
+  hostPulse(_tr, 0, (5000 + hostRand() % 15001) * 1000);
+  for(unsigned _i = 0; _i < _Count; _i++)
+  {
+    hostPulse(_tr, !(_i & 1), (50 + hostRand() % 2951) * 1000);
+  };
+  hostPulse(_tr, 0, (5000 + hostRand() % 15001) * 1000);
+};
+
+/* -------------------------------------------------------
+ * @brief Build a synthetic trace
+ * @param _tr: Trace (empty)
+ * @param _g: Generator settings
+ * @retval None
+ * @note Frame: HIGH T + LOW 31T preamble, then EV_Data_Bits bits, first bit
+ *       first: '0' = HIGH T + LOW 3T, '1' = HIGH 3T + LOW T
+ * @note Every press ends with a 1T HIGH, so the final LOW of its last frame
+ *       is measured like every other one
+ * ------------------------------------------------------- */
+static void hostGenerate(host_Trace_T *_tr, const host_Gen_T *_g)
+{
+  hostRandState = _g->Seed ? _g->Seed : 1;
+  _tr->Merge = true;
+
+  for(unsigned _k = 0; _k < _g->Presses; _k++)
+  {
+    uint32_t _Code = hostRand() & (uint32_t)EV_Frame_Mask;
+    double _T = _g->T_us * (1.0 + hostUniform() * _g->Drift / 100.0);
+
+    hostGenNoise(_tr, _g->Idle);
+    for(unsigned _r = 0; _r < _g->Repeats; _r++)
+    {
+      hostSent(_tr, _Code);
+      hostGenPulse(_tr, _g, 1, _T);
+      hostGenPulse(_tr, _g, 0, 31 * _T);
+      for(uint8_t _i = 0; _i < EV_Data_Bits; _i++)
+      {
+        uint8_t _Bit = (_Code >> _i) & 1;
+        hostGenPulse(_tr, _g, 1, _Bit ? 3 * _T : _T);
+        hostGenPulse(_tr, _g, 0, _Bit ? _T : 3 * _T);
+      };
+    };
+    hostGenPulse(_tr, _g, 1, _T);                          /**< Closing sync HIGH ends the last LOW, as ev1527_Transmit() does */
+  };
+  hostGenNoise(_tr, _g->Idle);
+};
+
+
+/* -------------------------------------------------------
+ * @brief Print a trace in text format
+ * @param _tr: Trace
+ * @param _g: Settings, written as a comment
+ * @retval None
+ * ------------------------------------------------------- */
+static void hostWrite(const host_Trace_T *_tr, const host_Gen_T *_g)
+{
+  printf("# ev1527_host gen -n %u -r %u -t %u -j %u -d %u -g %u -i %u -s %u\n",
+         _g->Presses, _g->Repeats, _g->T_us, _g->Jitter, _g->Drift, _g->Glitch, _g->Idle, (unsigned)_g->Seed);
+  printf("# %u frames, %zu pulses, widths in microseconds\n", (unsigned)_tr->Sent, _tr->Count);
+
+  uint32_t _Frame = 0;
+  for(size_t _i = 0; _i < _tr->Count; _i++)
+  {
+    while((_Frame < _tr->Sent) && (_tr->Start[_Frame] == _i))
+    {
+      printf("= %06lX\n", (unsigned long)_tr->startCode[_Frame]);
+      _Frame++;
+    };
+    printf("%c %.1f\n", _tr->Pulse[_i].Level ? 'H' : 'L', _tr->Pulse[_i].Width_ns / 1000.0);
+  };
+};
+
+
+/* ============================================================================
+ *                         DECODING RUN
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Hand one trace pulse to the decoder
+ * @param _p: Pulse
+ * @retval None
+ * @note Converts nanoseconds to timebase ticks (F_CPU / EV_Timer_Prescaler),
+ *       pulses beyond the 16-bit range saturate to EV_Tick_Overflow
+ * ------------------------------------------------------- */
+static inline void hostFeed(const host_Pulse_T *_p)
+{
+  uint64_t _Ticks = ((uint64_t)_p->Width_ns * (F_CPU / 1000000UL)) / (EV_Timer_Prescaler * 1000UL);
+  if(_Ticks > EV_Tick_Overflow) _Ticks = EV_Tick_Overflow;
+  ev1527_Feed(0, (uint16_t)_Ticks, _p->Level ? EV_Level_High : EV_Level_Low);
+  ev1527_Process();
+};
+
+/* -------------------------------------------------------
+ * @brief Drop frames left over from a previous run
+ * @retval None
+ * ------------------------------------------------------- */
+static void hostDrain(void)
+{
+  ev1527_T _Code;
+#if EV_Queue_Enable
+  while(ev1527_Read(&_Code));
+#endif
+  (void)ev1527_Take(&_Code);
+};
+
+/* -------------------------------------------------------
+ * @brief Take every decoded frame and match it against the sent codes
+ * @param _tr: Trace
+ * @param _res: Result counters
+ * @param _pressCode: Code of the press being received
+ * @param _pressHit: Set when a frame with _pressCode is decoded
+ * @retval None
+ * @note EV_Reception_Single: the decoder is re-armed after each frame
+ * ------------------------------------------------------- */
+static void hostCollect(host_Trace_T *_tr, host_Result_T *_res, uint32_t _pressCode, bool *_pressHit)
+{
+  ev1527_T _Code;
+#if EV_Queue_Enable
+  while(ev1527_Read(&_Code))
+#else
+  while(ev1527_Take(&_Code))
+#endif
+  {
+    uint32_t _Frame = (uint32_t)EV_Code_Frame(_Code);
+    host_Code_T *_c = hostCode(_tr, _Frame, false);
+    _res->Decoded++;
+    if(_Frame == _pressCode) *_pressHit = true;
+    if((_c != NULL) && _c->Sent) _c->Decoded++;
+    else _res->False++;
+#if EV_Reception_Mode == EV_Reception_Single
+    ev1527_Init();
+#endif
+  };
+};
+
+/* -------------------------------------------------------
+ * @brief Decode a trace and time the decoder
+ * @param _tr: Trace
+ * @param _res: Result
+ * @retval None
+ * @note Pass 1 decodes and matches the frames. Pass 2 feeds the trace again
+ *       for at least 200ms of host time without reading the output.
+ * @note A press ends where the next frame with another code starts. Its frame
+ *       must be decoded before that point, the frame that follows it in the
+ *       trace is not counted for it.
+ * ------------------------------------------------------- */
+static void hostRun(host_Trace_T *_tr, host_Result_T *_res)
+{
+  memset(_res, 0, sizeof(*_res));
+  for(size_t _i = 0; _i < _tr->codeCount; _i++) _tr->Code[_i].Decoded = 0;
+
+  uint32_t _Frame = 0, _pressCode = 0;
+  bool _inPress = false, _pressHit = false;
+  ev1527_Init();
+  hostDrain();
+  for(size_t _i = 0; _i < _tr->Count; _i++)
+  {
+    while((_Frame < _tr->Sent) && (_tr->Start[_Frame] <= _i))
+    {
+      if(!_inPress || (_tr->startCode[_Frame] != _pressCode))  /**< A new press starts */
+      {
+        if(_pressHit) _res->pressDecoded++;
+        if(_inPress) _res->Presses++;
+        _inPress = true;
+        _pressHit = false;
+        _pressCode = _tr->startCode[_Frame];
+      };
+      _Frame++;
+    };
+    hostFeed(&_tr->Pulse[_i]);
+    hostCollect(_tr, _res, _pressCode, &_pressHit);
+  };
+  ev1527_deInit();
+  if(_pressHit) _res->pressDecoded++;
+  if(_inPress) _res->Presses++;
+
+  _res->Sent = _tr->Sent;
+  for(size_t _i = 0; _i < _tr->codeCount; _i++)
+  {
+    host_Code_T *_c = &_tr->Code[_i];
+    _res->Correct += (_c->Decoded < _c->Sent) ? _c->Decoded : _c->Sent;
+  };
+
+  if(_tr->Count == 0) return;
+  struct timespec _Start, _Stop;
+  uint64_t _Edges = 0;
+  double _Elapsed = 0.0;
+  ev1527_Init();
+  clock_gettime(CLOCK_MONOTONIC, &_Start);
+  do
+  {
+    for(size_t _i = 0; _i < _tr->Count; _i++) hostFeed(&_tr->Pulse[_i]);
+    _Edges += _tr->Count;
+    clock_gettime(CLOCK_MONOTONIC, &_Stop);
+    _Elapsed = (_Stop.tv_sec - _Start.tv_sec) * 1e9 + (_Stop.tv_nsec - _Start.tv_nsec);
+  } while(_Elapsed < 200e6);
+  ev1527_deInit();
+  _res->nsPerEdge = _Elapsed / _Edges;
+};
+
+/* -------------------------------------------------------
+ * @brief Read a limits file
+ * @param _Path: File name
+ * @retval true on success
+ * ------------------------------------------------------- */
+static bool hostLoadLimits(const char *_Path)
+{
+  FILE *_f = fopen(_Path, "r");
+  if(_f == NULL) { perror(_Path); return false; };
+
+  char _Line[160];
+  unsigned _LineNo = 0;
+  while(fgets(_Line, sizeof(_Line), _f))
+  {
+    char _Col[4][16];
+    int _Used = 0;
+    _LineNo++;
+    if((_Line[0] == '#') || (_Line[0] == '\n')) continue;
+    if((hostLimitCount == sizeof(hostLimits) / sizeof(hostLimits[0])) ||
+       (sscanf(_Line, "%15s %15s %15s %15s %n", _Col[0], _Col[1], _Col[2], _Col[3], &_Used) != 4) || (_Line[_Used] == 0))
+    {
+      fprintf(stderr, "%s:%u: bad limits line\n", _Path, _LineNo);
+      fclose(_f);
+      return false;
+    };
+    host_Limit_T *_l = &hostLimits[hostLimitCount++];
+    _Line[strcspn(_Line, "\r\n")] = 0;
+    snprintf(_l->Name, sizeof(_l->Name), "%s", _Line + _Used);
+    _l->minFrame = (_Col[0][0] == '-') ? -1.0 : strtod(_Col[0], NULL);
+    _l->minPress = (_Col[1][0] == '-') ? -1.0 : strtod(_Col[1], NULL);
+    _l->maxFalse = (_Col[2][0] == '-') ? -1.0 : strtod(_Col[2], NULL);
+    _l->maxCount = (_Col[3][0] == '-') ? -1 : strtol(_Col[3], NULL, 10);
+  };
+  fclose(_f);
+  return true;
+};
+
+/* -------------------------------------------------------
+ * @brief Check one result row against its limits, print the misses
+ * @param _Key: Row name in the limits file
+ * @param _res: Result
+ * @retval None
+ * ------------------------------------------------------- */
+static void hostCheck(const char *_Key, const host_Result_T *_res)
+{
+  for(size_t _i = 0; _i < hostLimitCount; _i++)
+  {
+    const host_Limit_T *_l = &hostLimits[_i];
+    if(strcmp(_l->Name, _Key) != 0) continue;
+
+    double _Frame = _res->Sent ? 100.0 * _res->Correct / _res->Sent : 100.0;
+    double _Press = _res->Presses ? 100.0 * _res->pressDecoded / _res->Presses : 100.0;
+    double _False = _res->Decoded ? 100.0 * _res->False / _res->Decoded : 0.0;
+    bool _Miss = false;
+    if((_l->minFrame >= 0) && (_Frame < _l->minFrame)) { printf("  FAIL frame%% < %.1f", _l->minFrame); _Miss = true; };
+    if((_l->minPress >= 0) && (_Press < _l->minPress)) { printf("  FAIL press%% < %.1f", _l->minPress); _Miss = true; };
+    if((_l->maxFalse >= 0) && (_False > _l->maxFalse)) { printf("  FAIL false%% > %.2f", _l->maxFalse); _Miss = true; };
+    if((_l->maxCount >= 0) && (_res->False > (uint32_t)_l->maxCount)) { printf("  FAIL false > %ld", _l->maxCount); _Miss = true; };
+    if(_Miss) hostMissed++;
+    return;
+  };
+};
+
+/* -------------------------------------------------------
+ * @brief Print the table header
+ * ------------------------------------------------------- */
+static void hostHeader(const char *_Title)
+{
+  printf("%-34s %7s %7s %7s %7s %6s %7s %8s\n", _Title, "frames", "decoded", "frame%", "press%", "false", "false%", "ns/edge");
+};
+
+/* -------------------------------------------------------
+ * @brief Print one result row
+ * ------------------------------------------------------- */
+static void hostReport(const char *_Name, const char *_Key, const host_Result_T *_res)
+{
+  char _Rate[16] = "-", _Press[16] = "-", _False[16] = "-";
+  if(_res->Sent) snprintf(_Rate, sizeof(_Rate), "%.1f%%", 100.0 * _res->Correct / _res->Sent);
+  if(_res->Presses) snprintf(_Press, sizeof(_Press), "%.1f%%", 100.0 * _res->pressDecoded / _res->Presses);
+  if(_res->Decoded) snprintf(_False, sizeof(_False), "%.2f%%", 100.0 * _res->False / _res->Decoded);
+  printf("%-34s %7u %7u %7s %7s %6u %7s %8.1f", _Name, (unsigned)_res->Sent, (unsigned)_res->Decoded,
+         _Rate, _Press, (unsigned)_res->False, _False, _res->nsPerEdge);
+  hostCheck(_Key, _res);
+  printf("\n");
+};
+
+
+/* ============================================================================
+ *                         COMMANDS
+ * ============================================================================ */
+
+static const host_Gen_T hostGenDefault = { 100, 4, 320, 0, 0, 0, 20, 1 };
+
+/* -------------------------------------------------------
+ * @brief Parse generator options
+ * @retval true if all options were valid
+ * ------------------------------------------------------- */
+static bool hostOptions(int _argc, char **_argv, host_Gen_T *_g)
+{
+  *_g = hostGenDefault;
+  for(int _i = 0; _i < _argc; _i++)
+  {
+    if((_argv[_i][0] != '-') || (_argv[_i][1] == 0) || (_argv[_i][2] != 0) || (_i + 1 >= _argc)) return false;
+    unsigned _Value = (unsigned)strtoul(_argv[++_i], NULL, 0);
+    switch(_argv[_i - 1][1])
+    {
+      case 'n': _g->Presses = _Value; break;
+      case 'r': _g->Repeats = _Value; break;
+      case 't': _g->T_us = _Value; break;
+      case 'j': _g->Jitter = _Value; break;
+      case 'd': _g->Drift = _Value; break;
+      case 'g': _g->Glitch = _Value; break;
+      case 'i': _g->Idle = _Value; break;
+      case 's': _g->Seed = _Value; break;
+      default: return false;
+    };
+  };
+  return true;
+};
+
+/* -------------------------------------------------------
+ * @brief Generate one synthetic trace, decode it and print the row
+ * ------------------------------------------------------- */
+static void hostSweepRow(const char *_Name, const host_Gen_T *_g)
+{
+  host_Trace_T _tr = { 0 };
+  host_Result_T _res;
+  hostGenerate(&_tr, _g);
+  hostRun(&_tr, &_res);
+  hostReport(_Name, _Name, &_res);
+  hostFree(&_tr);
+};
+
+/* -------------------------------------------------------
+ * @brief Synthetic sweep: one impairment at a time, then receiver noise only
+ * ------------------------------------------------------- */
+static void hostSweep(void)
+{
+  static const uint8_t _Jitter[] = { 0, 10, 20, 30, 40 };
+  static const uint8_t _Drift[]  = { 10, 20, 30 };
+  static const uint8_t _Glitch[] = { 5, 20, 50 };
+  char _Name[40];
+  host_Gen_T _g;
+
+  printf("\nsynthetic: %u presses x %u frames, T=%uus, %u noise pulses between presses\n",
+         hostGenDefault.Presses, hostGenDefault.Repeats, hostGenDefault.T_us, hostGenDefault.Idle);
+  hostHeader("impairment");
+  for(uint8_t _i = 0; _i < sizeof(_Jitter); _i++)
+  {
+    _g = hostGenDefault;
+    _g.Jitter = _Jitter[_i];
+    snprintf(_Name, sizeof(_Name), "jitter +/-%u%%", _g.Jitter);
+    hostSweepRow(_Name, &_g);
+  };
+  for(uint8_t _i = 0; _i < sizeof(_Drift); _i++)
+  {
+    _g = hostGenDefault;
+    _g.Drift = _Drift[_i];
+    snprintf(_Name, sizeof(_Name), "T drift +/-%u%% per press", _g.Drift);
+    hostSweepRow(_Name, &_g);
+  };
+  for(uint8_t _i = 0; _i < sizeof(_Glitch); _i++)
+  {
+    _g = hostGenDefault;
+    _g.Glitch = _Glitch[_i];
+    snprintf(_Name, sizeof(_Name), "glitches %u per 1000 pulses", _g.Glitch);
+    hostSweepRow(_Name, &_g);
+  };
+  _g = hostGenDefault;
+  _g.Presses = 0;
+  _g.Idle = 200000;
+  hostSweepRow("receiver noise only, 200000 pulses", &_g);
+};
+
+static int hostUsage(void)
+{
+  fprintf(stderr, "usage: ev1527_host [-l limits] replay <trace>...\n"
+                  "       ev1527_host gen [-n presses] [-r repeats] [-t T_us] [-j jitter%%] [-d drift%%]\n"
+                  "                       [-g glitches/1000] [-i idle pulses] [-s seed]\n"
+                  "       ev1527_host [-l limits] sweep\n");
+  return 2;
+};
+
+/* -------------------------------------------------------
+ * @brief Exit status of replay / sweep
+ * @param _Status: 1 if a trace could not be loaded
+ * @retval 1 on a load error or a missed limit, else 0
+ * ------------------------------------------------------- */
+static int hostStatus(int _Status)
+{
+  if(hostMissed) printf("%u row(s) missed their limits\n", hostMissed);
+  return (_Status || hostMissed) ? 1 : 0;
+};
+
+int main(int argc, char **argv)
+{
+  if((argc >= 3) && (strcmp(argv[1], "-l") == 0))
+  {
+    if(!hostLoadLimits(argv[2])) return 2;
+    argc -= 2;
+    argv += 2;
+  };
+  if(argc < 2) return hostUsage();
+
+  if(strcmp(argv[1], "replay") == 0)
+  {
+    int _Status = 0;
+    printf("ev1527 host harness: EV_Data_Bits=%u, EV_Timer_Prescaler=%u, F_CPU=%lu\n",
+           (unsigned)EV_Data_Bits, (unsigned)EV_Timer_Prescaler, (unsigned long)F_CPU);
+    hostHeader("trace");
+    for(int _i = 2; _i < argc; _i++)
+    {
+      host_Trace_T _tr = { 0 };
+      host_Result_T _res;
+      if(hostLoad(&_tr, argv[_i]))
+      {
+        hostRun(&_tr, &_res);
+        const char *_Base = strrchr(argv[_i], '/');
+        hostReport(argv[_i], _Base ? _Base + 1 : argv[_i], &_res);  /**< Limits name the file without its directory */
+      }
+      else
+      {
+        _Status = 1;
+      };
+      hostFree(&_tr);
+    };
+    return hostStatus(_Status);
+  };
+
+  if(strcmp(argv[1], "gen") == 0)
+  {
+    host_Gen_T _g;
+    host_Trace_T _tr = { 0 };
+    if(!hostOptions(argc - 2, argv + 2, &_g)) return hostUsage();
+    hostGenerate(&_tr, &_g);
+    hostWrite(&_tr, &_g);
+    hostFree(&_tr);
+    return 0;
+  };
+
+  if(strcmp(argv[1], "sweep") == 0)
+  {
+    hostSweep();
+    return hostStatus(0);
+  };
+
+  return hostUsage();
+};
@@ -0,0 +1,34 @@
+/**
+ ******************************************************************************
+ * @file     aKaReZa.h
+ * @brief    Host stand-in for aKaReZa.h, used by the EV1527 test harness
+ *
+ * @note     Provides only what ev1527.c needs with EV_Capture_Software:
+ *           the standard integer types and the bit macros. No AVR register
+ *           is declared, so a configuration that still touches the hardware
+ *           (EV_Bench_Enable, EV_Tx_Enable, EV_Raw_UART, ...) does not compile
+ *           here instead of silently reading a dummy variable.
+ ******************************************************************************
+ */
+#ifndef _aKaReZa_H_
+#define _aKaReZa_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifndef F_CPU
+    #define F_CPU  16000000UL            /**< Timebase of the traces: ATmega328P at 16MHz */
+#endif
+
+#define bitSet(_Reg, _Bit)           ((_Reg) |=  (1UL << (_Bit)))
+#define bitClear(_Reg, _Bit)         ((_Reg) &= ~(1UL << (_Bit)))
+#define bitToggle(_Reg, _Bit)        ((_Reg) ^=  (1UL << (_Bit)))
+#define bitCheck(_Reg, _Bit)         (((_Reg) >> (_Bit)) & 0x01)
+#define bitChange(_Reg, _Bit, _Val)  ((_Val) ? bitSet(_Reg, _Bit) : bitClear(_Reg, _Bit))
+
+#define ISR(_Vector)                 void _Vector(void)
+#define cli()                        ((void)0)
+#define sei()                        ((void)0)
+
+#endif /* _aKaReZa_H_ */
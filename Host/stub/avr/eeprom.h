@@ -0,0 +1,27 @@
+/* Host stand-in: a RAM image of the ATmega328P EEPROM, erased (0xFF) at start */
+#ifndef _HOST_EEPROM_H_
+#define _HOST_EEPROM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define E2END  0x3FF
+
+static uint8_t hostEeprom[E2END + 1];
+static bool hostEepromReady = false;
+
+static inline uint8_t *hostEepromCell(const uint8_t *_Addr)
+{
+  if(!hostEepromReady)
+  {
+    memset(hostEeprom, 0xFF, sizeof(hostEeprom));
+    hostEepromReady = true;
+  };
+  return &hostEeprom[(uintptr_t)_Addr & E2END];
+};
+
+static inline uint8_t eeprom_read_byte(const uint8_t *_Addr)            { return *hostEepromCell(_Addr); };
+static inline void eeprom_update_byte(uint8_t *_Addr, uint8_t _Value)   { *hostEepromCell(_Addr) = _Value; };
+
+#endif
@@ -0,0 +1,11 @@
+/* Host stand-in: flash and SRAM share one address space */
+#ifndef _HOST_PGMSPACE_H_
+#define _HOST_PGMSPACE_H_
+
+#include <stdint.h>
+
+#define PROGMEM
+#define pgm_read_byte(_Addr)  (*(const uint8_t *)(uintptr_t)(_Addr))
+#define pgm_read_word(_Addr)  (*(const uint16_t *)(uintptr_t)(_Addr))
+
+#endif
@@ -0,0 +1,14 @@
+/* Host stand-in: sleeping returns at once */
+#ifndef _HOST_SLEEP_H_
+#define _HOST_SLEEP_H_
+
+#define SLEEP_MODE_IDLE       0
+#define SLEEP_MODE_PWR_DOWN   2
+#define SLEEP_MODE_PWR_SAVE   3
+
+#define set_sleep_mode(_Mode) ((void)(_Mode))
+#define sleep_enable()        ((void)0)
+#define sleep_disable()       ((void)0)
+#define sleep_cpu()           ((void)0)
+
+#endif
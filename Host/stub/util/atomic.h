@@ -0,0 +1,9 @@
+/* Host stand-in: the harness is single threaded, an atomic block is a plain block */
+#ifndef _HOST_ATOMIC_H_
+#define _HOST_ATOMIC_H_
+
+#define ATOMIC_RESTORESTATE   0
+#define ATOMIC_FORCEON        0
+#define ATOMIC_BLOCK(_Type)   for(uint8_t _ToDo = 1; _ToDo; _ToDo = 0)
+
+#endif
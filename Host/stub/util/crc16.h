@@ -0,0 +1,14 @@
+/* Host stand-in: same polynomial (0xA001, reflected) as avr-libc _crc16_update() */
+#ifndef _HOST_CRC16_H_
+#define _HOST_CRC16_H_
+
+#include <stdint.h>
+
+static inline uint16_t _crc16_update(uint16_t _CRC, uint8_t _Data)
+{
+  _CRC ^= _Data;
+  for(uint8_t _i = 0; _i < 8; _i++) _CRC = (_CRC & 1) ? ((_CRC >> 1) ^ 0xA001) : (_CRC >> 1);
+  return _CRC;
+};
+
+#endif
@@ -31,8 +31,11 @@
  *                  │
  *                  └─> If preamble detected:
  *                      └─> Validate pulse timing → Decode bit (compare HIGH/LOW)
- *                          → Store bit in rawValue → Increment index
- *                          → If 24 bits received: Set Detect flag → Disable decoder
+ *                          → Store bit in frame buffer → Increment index
+ *                          → If 24 bits received: Publish to ev1527_Data, set Detect flag
+ *                          → EV_Reception_Single: Disable decoder
+ *                          → EV_Reception_Continuous: Re-arm for the next frame
+ *                      └─> Invalid bit: abort frame, test the same pair as preamble
  * 
  *           3. Data Extraction Flow (After 24 bits):
  *              └─> ev1527_Data.Bits.Detect = 1 → User reads Address & Keys
@@ -43,6 +46,25 @@
  * 
  * @note     FUNCTION SUMMARY:
  *           - ISR(INT0_vect)  : Interrupt handler for edge detection and pulse measurement
+ *           - ISR(TIMER1_CAPT_vect) : Input capture handler (EV_Capture_ICP1 backend)
+ *           - ISR(TIMER1_OVF_vect)  : Timebase extension for long pulses (EV_Capture_ICP1 backend)
+ *                                     Idle timeout / Timer1 gating (EV_Capture_INT0, low-power)
+ *                                     Shared timebase epoch (EV_Capture_Shared)
+ *           - ISR(INT0/INT1/PCINTn_vect) : Per-source edge dispatch (EV_Capture_Shared)
+ *           - ISR(TIMER1_COMPA_vect) : Noise storm back-off and pin sampling (EV_Storm_Enable)
+ *           - ev1527_edgeCapture    : Shared timebase pulse measurement per channel
+ *           - ev1527_Idle     : Sleep between RF edges (EV_LowPower_Mode)
+ *           - ev1527_pulseHandler   : Backend independent HIGH/LOW pair decoder (per channel context)
+ *           - ev1527_protocolHandler : Table driven decoders (PT2262, HT12E, user protocol)
+ *           - ev1527_Learn / ev1527_Forget / ev1527_Known : Hashed address whitelist
+ *           - ev1527_storeSave / ev1527_storeCompact : Wear-leveled EEPROM journal (EV_Store_Enable)
+ *           - ev1527_RawStart / ev1527_RawDump : Raw pulse capture and binary dump (EV_Raw_Enable)
+ *           - ev1527_GetStats : Decoder statistics snapshot (EV_Stats_Enable)
+ *           - ev1527_GetBench : Per-path decoder cycle histogram (EV_Bench_Enable)
+ *           - ev1527_Feed     : Software capture entry, no hardware access (EV_Capture_Software)
+ *           - ev1527_Process  : Deferred decoder task (EV_Decode_Deferred)
+ *           - ev1527_Available / ev1527_Read / ev1527_Overflow : Output frame queue
+ *           - ev1527_Take / ev1527_OnFrame : Atomic frame read, frame handler (EV_Callback_Enable)
  *           - ev1527_Init     : Initialize Timer1 and INT0 for RF signal capture
  *           - ev1527_deInit   : Disable Timer1 and INT0 to stop decoding
  * 
@@ -67,126 +89,2263 @@
 
 #include "ev1527.h"
 
+#if EV_LowPower_Mode != EV_LowPower_Off
+    #include <avr/sleep.h>
+#endif
+
+#include <util/atomic.h>
+
+#if EV_Store_Enable
+    #include <avr/eeprom.h>
+#endif
+
+#if EV_Store_Enable || EV_Raw_Enable
+    #include <util/crc16.h>
+#endif
+
+#if EV_Protocol_Count
+    #include <avr/pgmspace.h>
+#endif
+
+
+/* ============================================================================
+ *                         DECODER CONTEXT
+ * ============================================================================ */
+
+#if EV_Protocol_Count
+/**
+ * @brief State of one table protocol decoder (see ev1527_Protocols)
+ */
+typedef struct
+{
+    bool Sync;                           /**< Flag: true=sync pair found, decoding data bits */
+    uint8_t Index;                       /**< Current bit index */
+    uint16_t tickHalf;                   /**< Half bit pair ((bitShort+bitLong)×T/2): window minimum and '1' threshold */
+    uint16_t tickMax;                    /**< Bit window maximum (3×tickHalf) */
+    uint32_t Buffer;                     /**< Shift accumulator: bits enter at bit 31, first bit ends lowest */
+} ev1527_protoState_T;
+
+/* Enabled protocols, decoded in parallel with the built-in EV1527 state machine (flash) */
+static const ev1527_Protocol_T ev1527_Protocols[EV_Protocol_Count] PROGMEM =
+{
+#if EV_Protocol_PT2262
+    EV_Protocol_Def(EV_Proto_PT2262, EV_ProtoFlag_TriState, 1, 31, 1, 3, 24, EV_PT2262_T_min_us, EV_PT2262_T_Max_us),
+#endif
+#if EV_Protocol_HT12E
+    EV_Protocol_Def(EV_Proto_HT12E, EV_ProtoFlag_Inverted, 36, 1, 1, 2, 12, EV_HT12E_T_min_us, EV_HT12E_T_Max_us),
+#endif
+#ifdef EV_Protocol_User
+    EV_Protocol_User,
+#endif
+};
+
+/* Table fields are read with LPM, the index is a constant after loop unrolling */
+#define EV_Proto_Byte(_p, _field)  pgm_read_byte(&ev1527_Protocols[_p]._field)
+#define EV_Proto_Word(_p, _field)  pgm_read_word(&ev1527_Protocols[_p]._field)
+#endif
+
+#if EV_Stamp_Enable
+/**
+ * @brief Timing part of a queued record, stored beside frameQueue
+ */
+typedef struct
+{
+    uint16_t Time;                       /**< Decoder clock >> EV_Stamp_Shift */
+    uint8_t Repeat;                      /**< Repeat count */
+    uint8_t Gesture;                     /**< EV_Gesture_xxx */
+} ev1527_Stamp_T;
+#endif
+
+/**
+ * @brief Complete decoder state of one receiver channel
+ * @note Written by the capture ISR (EV_Decode_ISR) or by ev1527_Process()
+ *       (EV_Decode_Deferred); only the pulse ring indices cross the boundary
+ */
+typedef struct
+{
+    volatile bool firstTime_Trigger;     /**< Flag: true=waiting for first edge, false=measuring */
+    bool preambleDetec;                  /**< Flag: true=preamble detected, decoding data bits */
+    uint8_t _Index;                      /**< Current bit index in decoded data (0 to EV_maxIndexData) */
+    uint8_t Channel;                     /**< Channel number tagged into published frames */
+    uint16_t Signal_High_Tick;           /**< HIGH pulse duration in timer ticks */
+    uint16_t Signal_Low_Tick;            /**< LOW pulse duration in timer ticks */
+    ev1527_frame_T frameBuffer;          /**< Shift accumulator: bits enter at EV_Frame_Top, published when complete */
+#if EV_Adaptive_T
+    uint16_t frameTick_Ref;              /**< Bit length (4T) averaged over the preamble and the bits so far */
+#endif
+#if EV_Clock_Enable
+    uint32_t decoderClock;               /**< Sum of decoded pulse durations (ticks) */
+#endif
+#if EV_Confirm_Enable
+    ev1527_frame_T confirmFrame;         /**< Last decoded frame */
+    uint32_t confirmTime;                /**< decoderClock when confirmFrame arrived */
+    uint8_t confirmCount;                /**< Identical consecutive copies of confirmFrame */
+#endif
+#if EV_Protocol_Count
+    ev1527_protoState_T protoState[EV_Protocol_Count];   /**< Table protocol decoders */
+#endif
+#if EV_Decode_Mode == EV_Decode_Deferred
+    volatile uint16_t pulseBuffer[EV_pulseBuffer_Size];  /**< Packed entries: bits 15-1 duration, bit 0 level */
+    volatile uint8_t pulseHead;          /**< Write index - modified by capture ISR only */
+    volatile uint8_t pulseTail;          /**< Read index - modified by ev1527_Process only */
+    bool pulseLost;                      /**< Pulse dropped on full buffer, gap marker pending (ISR only) */
+#endif
+#if EV_Capture_Mode == EV_Capture_Shared
+    uint16_t lastStamp;                  /**< TCNT1 at the previous edge */
+    uint16_t lastEpoch;                  /**< timerEpoch at the previous edge */
+    uint8_t lastLevel;                   /**< Level of the pulse ended by the previous edge */
+#endif
+#if EV_Soft_Enable
+    int8_t softVotes[EV_maxIndexData + 1];  /**< Per bit position: weighted ones minus zeros over the merged frames */
+    ev1527_frame_T softErase;            /**< Erasure mask, shifted in parallel with frameBuffer */
+    ev1527_frame_T softWeak;             /**< Ambiguous bit mask, shifted in parallel with frameBuffer */
+    uint8_t softErasures;                /**< Erasures in the current frame */
+    uint8_t softFrames;                  /**< Frames merged into softVotes */
+    uint16_t softGap;                    /**< Ticks since the last merged frame (saturating) */
+#endif
+#if EV_Quality_Enable
+    uint16_t qualityRef;                 /**< Length of the first data bit (period reference) */
+    uint32_t qualityErr;                 /**< Sum of split and period errors (ticks) */
+    uint32_t qualitySum;                 /**< Sum of data bit lengths (ticks) */
+#endif
+#if EV_Stamp_Enable
+    volatile uint8_t idleWraps;          /**< Silent Timer1 periods not yet added to decoderClock (capture side) */
+    bool stampGap;                       /**< Silent period or reset since stampLast - next frame is a new press */
+    uint8_t stampRepeat;                 /**< Repeat count of the current key press */
+    ev1527_frame_T stampFrame;           /**< Frame of the current key press */
+    uint32_t stampLast;                  /**< decoderClock at the latest frame */
+#if EV_Gesture_Enable
+    uint32_t stampPress;                 /**< decoderClock at the first frame of the key press */
+    uint8_t stampGesture;                /**< Gesture of the latest frame */
+    bool gestureLong;                    /**< Current press already reported as EV_Gesture_Long */
+    bool gestureShort;                   /**< Previous press was a short single press (double click candidate) */
+#endif
+#endif
+#if EV_Glitch_Enable
+    uint16_t glitchTick;                 /**< Held pulse duration, grows while glitches are merged */
+    uint8_t glitchLevel;                 /**< Held pulse level (EV_Glitch_None: nothing held) */
+#endif
+} ev1527_Channel_T;
+
+#if EV_Capture_Mode == EV_Capture_Shared
+/* Channel to source binding, evaluated by the preprocessor */
+#define EV_Source_Bit(_src, _pin)   (((_src) == EV_Source_INT0) ? 2 : (((_src) == EV_Source_INT1) ? 3 : (_pin)))
+#define EV_Channel_Is(_n, _src)     ((EV_Channel_Count > (_n)) && (EV_Channel##_n##_Source == (_src)))
+#define EV_Channel_Mask(_n, _src)   (EV_Channel_Is(_n, _src) ? (1 << EV_Source_Bit(_src, EV_Channel##_n##_Pin)) : 0)
+#define EV_Source_Mask(_src)        (EV_Channel_Mask(0, _src) | EV_Channel_Mask(1, _src) | EV_Channel_Mask(2, _src) | EV_Channel_Mask(3, _src))
+#define EV_Source_Count(_src)       (EV_Channel_Is(0, _src) + EV_Channel_Is(1, _src) + EV_Channel_Is(2, _src) + EV_Channel_Is(3, _src))
+
+#if (EV_Source_Count(EV_Source_INT0) > 1) || (EV_Source_Count(EV_Source_INT1) > 1)
+    #error "INT0 and INT1 can serve one channel each"
+#endif
+
+#if EV_Source_Count(EV_Source_None) != 0
+    #error "Every channel below EV_Channel_Count needs an EV_ChannelN_Source"
+#endif
+#endif
+
 
 /* ============================================================================
  *                         GLOBAL VARIABLES
  * ============================================================================ */
 volatile ev1527_T ev1527_Data = {.rawValue = 0x0};  /**< Decoded RF data structure - volatile for ISR access */
 
+/* Decoder state machine contexts (one per receiver channel) */
+static ev1527_Channel_T ev1527_Channels[EV_Channel_Count];
+
+#if EV_Queue_Enable
+/* Decoded frame FIFO (single producer: decoder, single consumer: ev1527_Read) */
+static volatile ev1527_T frameQueue[EV_Queue_Size];        /**< Decoded frames waiting for the application */
+#if EV_Stamp_Enable
+static volatile ev1527_Stamp_T frameStamp[EV_Queue_Size];  /**< Written with the frameQueue slot of the same index */
+#endif
+static volatile uint8_t frameHead = 0;                     /**< Write index - modified by decoder only */
+static volatile uint8_t frameTail = 0;                     /**< Read index - modified by ev1527_Read only */
+static volatile uint8_t frameOverflow = 0;                 /**< Frames dropped on full queue (saturates at 255) */
+#endif
+
+#if EV_Capture_Mode == EV_Capture_Shared
+static volatile uint16_t timerEpoch = 0;                   /**< Timer1 overflow count - upper half of the shared timebase */
+#endif
+
+#if EV_Callback_Enable
+static ev1527_Handler_T frameHandler = NULL;               /**< Registered by ev1527_OnFrame() */
+#endif
+
+#if EV_LowPower_Mode != EV_LowPower_Off
+static volatile bool frameEvent = false;                   /**< Frame published since the last ev1527_Idle() */
+#endif
+
+#if EV_Capture_Mode == EV_Capture_Software
+static volatile bool feedEnabled = false;                  /**< ev1527_Feed() accepted between ev1527_Init() and ev1527_deInit() */
+#endif
+
+#if EV_Whitelist_Enable
+/* Enrolled addresses: slot = address + 1, so the zeroed table is empty at reset */
+#define EV_Whitelist_Deleted  ((ev1527_frame_T)(0xFFFFFFFFUL >> (32 - 8 * EV_Whitelist_SlotBytes)))  /**< Slot of a forgotten address (keeps probe chains intact) */
+static uint8_t whitelistTable[EV_Whitelist_Size][EV_Whitelist_SlotBytes];  /**< Packed slots, 3 bytes for 20-bit addresses */
+static uint16_t whitelistCount = 0;                        /**< Enrolled addresses */
+static volatile bool whitelistLearn = false;               /**< Pairing: enroll the next frame */
+#endif
+
+#if EV_Store_Enable
+/* EEPROM journal state (main loop only, except storePending) */
+#define EV_Store_Magic     0xE5                            /**< Header marker */
+#define EV_Store_OpAdd     0x1                             /**< Record op: address enrolled */
+#define EV_Store_OpDel     0x2                             /**< Record op: address forgotten */
+#define EV_Store_Loaded    0xFFFF                          /**< storeLoad value once replay is complete */
+static uint8_t storeHalf = 0;                              /**< Active half (0 or 1) */
+static uint8_t storeGen = 0;                               /**< Generation of the active half */
+static bool storeFormatted = false;                        /**< Active half has a valid header */
+static uint16_t storeAppend = 0;                           /**< Next free record of the active half */
+static uint16_t storeLoad = EV_Store_Loaded;               /**< Next record to replay */
+static bool storeStarted = false;                          /**< Headers read (first ev1527_Init) */
+static volatile uint32_t storePending = 0;                 /**< Address + 1 enrolled by pairing, not yet saved */
+#endif
+
+#if EV_Raw_Enable
+#define EV_Raw_Off  0xFF                                   /**< rawChannel: raw capture stopped */
+
+static volatile uint16_t rawBuffer[EV_Raw_Size];           /**< Packed pulses: ticks, bit 0 = level */
+static volatile uint16_t rawCount = 0;                     /**< Pulses recorded - modified by capture ISR only while running */
+static volatile uint8_t rawChannel = EV_Raw_Off;           /**< Channel diverted into rawBuffer */
+#endif
+
+#if EV_Glitch_Enable
+#define EV_Glitch_None  0xFF                               /**< glitchLevel: no pulse held */
+#endif
+
+#if EV_Storm_Enable
+static uint16_t stormTicks = 0;                            /**< Signal time in the current detection window */
+static uint8_t stormEdges = 0;                             /**< Edges in the current detection window */
+static uint8_t stormHold = 0;                              /**< Back-off sampling periods left */
+static uint8_t stormQuiet = 0;                             /**< Consecutive LOW samples */
+#endif
+
+#if EV_Tx_Enable
+/* Transmitter state (main loop writes it only while Timer2 is stopped) */
+#if EV_Tx_Output == EV_Tx_OC2A
+#define EV_Tx_DDR        DDRB
+#define EV_Tx_PORT       PORTB
+#define EV_Tx_Bit        3                                 /**< PB3 = OC2A */
+#define EV_Tx_Com_Set    ((1 << COM2A1) | (1 << COM2A0))   /**< Set OC2A on compare match */
+#define EV_Tx_Com_Clear  (1 << COM2A1)                     /**< Clear OC2A on compare match */
+#define EV_Tx_Force      (1 << FOC2A)
+#else
+#define EV_Tx_DDR        DDRD
+#define EV_Tx_PORT       PORTD
+#define EV_Tx_Bit        3                                 /**< PD3 = OC2B */
+#define EV_Tx_Com_Set    ((1 << COM2B1) | (1 << COM2B0))   /**< Set OC2B on compare match */
+#define EV_Tx_Com_Clear  (1 << COM2B1)                     /**< Clear OC2B on compare match */
+#define EV_Tx_Force      (1 << FOC2B)
+#endif
+
+#define EV_Tx_LastHalf  (2 * EV_Data_Bits + 1)             /**< Half-pulse index of the last bit's LOW */
+
+static volatile bool txBusy = false;                       /**< Transmission running - cleared by TIMER2_COMPA_vect */
+static ev1527_frame_T txFrame;                             /**< Code being sent */
+static ev1527_frame_T txShift;                             /**< Bits of the current frame not sent yet, next bit in bit 0 */
+static uint8_t txRepeats;                                  /**< Frames still to start */
+static uint8_t txHalf;                                     /**< Current half-pulse: 0 sync HIGH, 1 sync LOW, then HIGH/LOW per bit */
+static uint16_t txLeft;                                    /**< Ticks of the current half-pulse not yet loaded into OCR2A */
+#endif
+
+#if EV_Debug_Enable
+#define EV_Debug_Bit  0                                    /**< PC0: debug pulse output */
+#endif
+
+#if EV_Stats_Enable
+static ev1527_Stats_T ev1527_Stats;                        /**< Counters - updated in decoder and capture context */
+
+#define EV_Stats_Inc(_Counter)  do { if((_Counter) != 0xFFFF) (_Counter)++; } while(0)  /**< Saturating 16-bit increment */
+#define EV_Stats(_Statement)    _Statement
+#else
+#define EV_Stats(_Statement)
+#endif
+
+#if EV_Bench_Enable
+static ev1527_Bench_T benchPaths[EV_Path_Count];           /**< Cycle measurement per decoder path */
+static uint8_t benchPath;                                  /**< Path taken by the pulse being decoded */
+
+#define EV_Bench_Path(_Path)  benchPath = (_Path)          /**< Mark the decoder path */
+#else
+#define EV_Bench_Path(_Path)
+#endif
+
+
+/* ============================================================================
+ *                         ADDRESS WHITELIST
+ * ============================================================================ */
+
+#if EV_Whitelist_Enable
+static inline ev1527_frame_T ev1527_slotRead(uint16_t _i)
+{
+  ev1527_frame_T _Slot = (ev1527_frame_T)whitelistTable[_i][0] | ((ev1527_frame_T)whitelistTable[_i][1] << 8);
+#if EV_Whitelist_SlotBytes > 2
+  _Slot |= (ev1527_frame_T)whitelistTable[_i][2] << 16;
+#endif
+#if EV_Whitelist_SlotBytes > 3
+  _Slot |= (ev1527_frame_T)whitelistTable[_i][3] << 24;
+#endif
+  return _Slot;
+};
+
+static inline void ev1527_slotWrite(uint16_t _i, ev1527_frame_T _Slot)
+{
+  whitelistTable[_i][0] = (uint8_t)_Slot;
+  whitelistTable[_i][1] = (uint8_t)(_Slot >> 8);
+#if EV_Whitelist_SlotBytes > 2
+  whitelistTable[_i][2] = (uint8_t)(_Slot >> 16);
+#endif
+#if EV_Whitelist_SlotBytes > 3
+  whitelistTable[_i][3] = (uint8_t)(_Slot >> 24);
+#endif
+};
+
+/* -------------------------------------------------------
+ * @brief Home slot of an address (folds the address bits)
+ * ------------------------------------------------------- */
+static inline uint16_t ev1527_slotHash(ev1527_frame_T _Address)
+{
+  return ((uint16_t)_Address ^ (uint16_t)(_Address >> 9)) & EV_Whitelist_Mask;
+};
+
+/* -------------------------------------------------------
+ * @brief Locate an enrolled address
+ * @param _Address: Transmitter address
+ * @retval Slot index, EV_Whitelist_Size if not enrolled
+ * @note Linear probing from the home slot, an empty slot ends the chain.
+ *       At most 3/4 of the slots are used, a lookup takes ~2 probes on average.
+ * ------------------------------------------------------- */
+static uint16_t ev1527_whitelistFind(ev1527_frame_T _Address)
+{
+  ev1527_frame_T _Key = _Address + 1;
+  uint16_t _i = ev1527_slotHash(_Address);
+
+  for(uint16_t _n = 0; _n < EV_Whitelist_Size; _n++)
+  {
+    ev1527_frame_T _Slot = ev1527_slotRead(_i);
+    if(_Slot == _Key) return _i;
+    if(_Slot == 0) break;                                  /**< Empty slot - not enrolled */
+    _i = (_i + 1) & EV_Whitelist_Mask;
+  };
+  return EV_Whitelist_Size;
+};
+
+/* -------------------------------------------------------
+ * @brief Enroll an address (no interrupt protection)
+ * @param _Address: Transmitter address
+ * @retval true if enrolled or already known, false if the table is full
+ * @note Reuses the first free or forgotten slot of the probe chain
+ * ------------------------------------------------------- */
+static bool ev1527_whitelistInsert(ev1527_frame_T _Address)
+{
+  if(ev1527_whitelistFind(_Address) != EV_Whitelist_Size) return true;
+  if(whitelistCount >= EV_Whitelist_Capacity) return false;
+
+  uint16_t _i = ev1527_slotHash(_Address);
+  ev1527_frame_T _Slot = ev1527_slotRead(_i);
+  while((_Slot != 0) && (_Slot != EV_Whitelist_Deleted))   /**< Always terminates: count < size */
+  {
+    _i = (_i + 1) & EV_Whitelist_Mask;
+    _Slot = ev1527_slotRead(_i);
+  };
+  ev1527_slotWrite(_i, _Address + 1);
+  whitelistCount++;
+  return true;
+};
+
+/* -------------------------------------------------------
+ * @brief Remove an address (no interrupt protection)
+ * @param _Address: Transmitter address
+ * @retval true if the address was enrolled
+ * @note The slot is marked deleted to keep probe chains intact;
+ *       the table is wiped when the last address goes
+ * ------------------------------------------------------- */
+static bool ev1527_whitelistRemove(ev1527_frame_T _Address)
+{
+  uint16_t _i = ev1527_whitelistFind(_Address);
+  if(_i == EV_Whitelist_Size) return false;
+
+  ev1527_slotWrite(_i, EV_Whitelist_Deleted);
+  whitelistCount--;
+  if(whitelistCount == 0)                                  /**< Drop accumulated deleted slots */
+  {
+    for(uint16_t _n = 0; _n < EV_Whitelist_Size; _n++) ev1527_slotWrite(_n, 0);
+  };
+  return true;
+};
+#endif
+
+
+#if EV_Store_Enable
+/* ============================================================================
+ *                         PERSISTENT REMOTE STORE
+ * ============================================================================ */
+
+#define EV_Store_HalfAddr(_h)      (EV_Store_Base + ((uint16_t)(_h) * EV_Store_HalfSize))
+#define EV_Store_RecordAddr(_h, _r) (EV_Store_HalfAddr(_h) + 4 + ((uint16_t)(_r) * 5))
+
+/* -------------------------------------------------------
+ * @brief CRC16 of an EEPROM block, seeded with a generation number
+ * @note Seeding makes records left over from older generations invalid
+ * ------------------------------------------------------- */
+static uint16_t ev1527_storeCRC(uint8_t _Gen, const uint8_t *_Data, uint8_t _Length)
+{
+  uint16_t _Crc = _crc16_update(0xFFFF, _Gen);
+  while(_Length--) _Crc = _crc16_update(_Crc, *_Data++);
+  return _Crc;
+};
+
+static void ev1527_storeWrite(uint16_t _Addr, const uint8_t *_Data, uint8_t _Length)
+{
+  while(_Length--) eeprom_update_byte((uint8_t *)(uintptr_t)(_Addr++), *_Data++);  /**< Unchanged bytes are not rewritten */
+};
+
+static void ev1527_storeRead(uint16_t _Addr, uint8_t *_Data, uint8_t _Length)
+{
+  while(_Length--) *_Data++ = eeprom_read_byte((const uint8_t *)(uintptr_t)(_Addr++));
+};
+
+/* -------------------------------------------------------
+ * @brief Read and check the header of one half
+ * @param _Half: 0 or 1
+ * @param _Gen: Generation of the half (output)
+ * @retval true if the header is valid
+ * ------------------------------------------------------- */
+static bool ev1527_storeHeader(uint8_t _Half, uint8_t *_Gen)
+{
+  uint8_t _Hdr[4];
+  ev1527_storeRead(EV_Store_HalfAddr(_Half), _Hdr, 4);
+  *_Gen = _Hdr[1];
+  return (_Hdr[0] == EV_Store_Magic) && (ev1527_storeCRC(0, _Hdr, 2) == ((uint16_t)_Hdr[2] | ((uint16_t)_Hdr[3] << 8)));
+};
+
+/* -------------------------------------------------------
+ * @brief Read and check one journal record of the active half
+ * @param _Record: Record index
+ * @param _Value: Address (bits 0-19) and op (bits 20-23) (output)
+ * @retval true if the record is valid (written in this generation)
+ * ------------------------------------------------------- */
+static bool ev1527_storeRecord(uint16_t _Record, uint32_t *_Value)
+{
+  uint8_t _Rec[5];
+  ev1527_storeRead(EV_Store_RecordAddr(storeHalf, _Record), _Rec, 5);
+  if(ev1527_storeCRC(storeGen, _Rec, 3) != ((uint16_t)_Rec[3] | ((uint16_t)_Rec[4] << 8))) return false;
+  *_Value = (uint32_t)_Rec[0] | ((uint32_t)_Rec[1] << 8) | ((uint32_t)_Rec[2] << 16);
+  return true;
+};
+
+static void ev1527_storeWriteRecord(uint8_t _Half, uint8_t _Gen, uint16_t _Record, uint8_t _Op, uint32_t _Address)
+{
+  uint8_t _Rec[5] = {(uint8_t)_Address, (uint8_t)(_Address >> 8), (uint8_t)(((_Address >> 16) & 0x0F) | (_Op << 4)), 0, 0};
+  uint16_t _Crc = ev1527_storeCRC(_Gen, _Rec, 3);
+  _Rec[3] = (uint8_t)_Crc;
+  _Rec[4] = (uint8_t)(_Crc >> 8);
+  ev1527_storeWrite(EV_Store_RecordAddr(_Half, _Record), _Rec, 5);
+};
+
+/* -------------------------------------------------------
+ * @brief Select the active half (called once from ev1527_Init)
+ * @retval None
+ * @note Reads only the two 4-byte headers, records are replayed later
+ * ------------------------------------------------------- */
+static void ev1527_storeBegin(void)
+{
+  uint8_t _Gen0, _Gen1;
+  bool _Valid0 = ev1527_storeHeader(0, &_Gen0);
+  bool _Valid1 = ev1527_storeHeader(1, &_Gen1);
+
+  storeStarted = true;
+  storeFormatted = _Valid0 || _Valid1;
+  if(_Valid0 && _Valid1) storeHalf = ((int8_t)(_Gen1 - _Gen0) > 0) ? 1 : 0;  /**< Newer generation wins */
+  else storeHalf = _Valid1 ? 1 : 0;
+  storeGen = storeHalf ? _Gen1 : _Gen0;
+  storeAppend = 0;
+  storeLoad = storeFormatted ? 0 : EV_Store_Loaded;        /**< Blank EEPROM - nothing to replay */
+};
+
+/* -------------------------------------------------------
+ * @brief Replay journal records into the whitelist
+ * @param _Count: Maximum number of records to replay
+ * @retval None
+ * @note The first invalid record marks the end of the journal (append position)
+ * ------------------------------------------------------- */
+static void ev1527_storeStep(uint16_t _Count)
+{
+  while((storeLoad != EV_Store_Loaded) && _Count--)
+  {
+    uint32_t _Value;
+    if((storeLoad >= EV_Store_Records) || !ev1527_storeRecord(storeLoad, &_Value))
+    {
+      storeAppend = storeLoad;                             /**< End of journal */
+      storeLoad = EV_Store_Loaded;
+      break;
+    };
+
+    uint32_t _Address = _Value & 0xFFFFFUL;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)                      /**< Decoder may read the table from the ISR */
+    {
+      if((_Value >> 20) == EV_Store_OpAdd) ev1527_whitelistInsert(_Address);
+      else ev1527_whitelistRemove(_Address);
+    };
+    storeLoad++;
+  };
+};
+
+/* -------------------------------------------------------
+ * @brief Write all enrolled addresses into the inactive half and activate it
+ * @retval None
+ * @note The header is written last: until then the old half stays valid
+ * ------------------------------------------------------- */
+static void ev1527_storeCompact(void)
+{
+  uint8_t _Half = storeHalf ^ 1;
+  uint8_t _Gen = storeGen + 1;
+  uint16_t _Record = 0;
+
+  for(uint16_t _i = 0; _i < EV_Whitelist_Size; _i++)
+  {
+    ev1527_frame_T _Slot;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+      _Slot = ev1527_slotRead(_i);
+    };
+    if((_Slot == 0) || (_Slot == EV_Whitelist_Deleted)) continue;
+    ev1527_storeWriteRecord(_Half, _Gen, _Record++, EV_Store_OpAdd, _Slot - 1);
+  };
+
+  uint8_t _Hdr[4] = {EV_Store_Magic, _Gen, 0, 0};
+  uint16_t _Crc = ev1527_storeCRC(0, _Hdr, 2);
+  _Hdr[2] = (uint8_t)_Crc;
+  _Hdr[3] = (uint8_t)(_Crc >> 8);
+  ev1527_storeWrite(EV_Store_HalfAddr(_Half), _Hdr, 4);    /**< Switch to the new half */
+
+  storeHalf = _Half;
+  storeGen = _Gen;
+  storeAppend = _Record;
+  storeFormatted = true;
+};
+
+/* -------------------------------------------------------
+ * @brief Persist one whitelist change (already applied in RAM)
+ * @param _Op: EV_Store_OpAdd or EV_Store_OpDel
+ * @param _Address: 20-bit address
+ * @retval None
+ * @note Appends one record (5 EEPROM bytes, ~17ms) or compacts a full half
+ * ------------------------------------------------------- */
+static void ev1527_storeSave(uint8_t _Op, uint32_t _Address)
+{
+  ev1527_storeStep(EV_Store_Loaded);                       /**< Append position is known after a full replay */
+
+  if(!storeFormatted || (storeAppend >= EV_Store_Records))
+  {
+    ev1527_storeCompact();                                 /**< New half already contains this change */
+    return;
+  };
+  ev1527_storeWriteRecord(storeHalf, storeGen, storeAppend++, _Op, _Address);
+};
+
+/* -------------------------------------------------------
+ * @brief Store maintenance from ev1527_Process()
+ * @retval None
+ * ------------------------------------------------------- */
+static void ev1527_storeTask(void)
+{
+  ev1527_storeStep(EV_Store_LoadBatch);
+
+  uint32_t _Pending;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    _Pending = storePending;
+    storePending = 0;
+  };
+  if(_Pending) ev1527_storeSave(EV_Store_OpAdd, _Pending - 1);  /**< Remote enrolled by ev1527_LearnNext() */
+};
+
+/* -------------------------------------------------------
+ * @brief Check if the EEPROM store has been loaded into the whitelist
+ * @retval true when all records are replayed
+ * ------------------------------------------------------- */
+bool ev1527_StoreReady(void)
+{
+  return (storeLoad == EV_Store_Loaded);
+};
+#endif
+
+
+#if EV_Whitelist_Enable
+/* ============================================================================
+ *                         WHITELIST ACCESS
+ * ============================================================================ */
+
+#if EV_Store_Enable
+    #define EV_Store_Sync()  ev1527_storeStep(EV_Store_Loaded)  /**< Finish lazy load before table access */
+#else
+    #define EV_Store_Sync()
+#endif
+
+/* -------------------------------------------------------
+ * @brief Whitelist stage of the decoder
+ * @param _frame: Decoded frame
+ * @retval true if the frame may be published
+ * @note Pairing mode (ev1527_LearnNext) enrolls and passes one frame,
+ *       the EEPROM copy is written later by ev1527_Process()
+ * ------------------------------------------------------- */
+static bool ev1527_whitelistPass(ev1527_frame_T _frame)
+{
+  ev1527_frame_T _Address = _frame & EV_Address_Mask;
+
+#if EV_Store_Enable && (EV_Decode_Mode == EV_Decode_Deferred)
+  ev1527_storeStep(EV_Store_Loaded);                       /**< Main-loop context: finish the lazy load first */
+#endif
+
+  if(whitelistLearn)
+  {
+    whitelistLearn = false;                                /**< One-shot pairing */
+#if EV_Store_Enable
+    if(ev1527_whitelistFind(_Address) == EV_Whitelist_Size) storePending = _Address + 1;
+#endif
+    return ev1527_whitelistInsert(_Address);
+  };
+  return (ev1527_whitelistFind(_Address) != EV_Whitelist_Size);
+};
+/* -------------------------------------------------------
+ * @brief Enroll a transmitter address
+ * @param _Address: Transmitter address (ev1527_T.Bits.Address)
+ * @retval true if enrolled or already known, false if the table is full
+ * @note EV_Store_Enable: a new address is also written to EEPROM (blocking)
+ * ------------------------------------------------------- */
+bool ev1527_Learn(uint32_t _Address)
+{
+  bool _Result, _New;
+  _Address &= EV_Address_Mask;
+  EV_Store_Sync();
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)                        /**< Decoder may read the table from the ISR */
+  {
+    _New = (ev1527_whitelistFind(_Address) == EV_Whitelist_Size);
+    _Result = ev1527_whitelistInsert(_Address);
+  };
+#if EV_Store_Enable
+  if(_Result && _New) ev1527_storeSave(EV_Store_OpAdd, _Address);
+#else
+  (void)_New;
+#endif
+  return _Result;
+};
+
+/* -------------------------------------------------------
+ * @brief Remove a transmitter address
+ * @param _Address: 20-bit address
+ * @retval true if the address was enrolled
+ * @note EV_Store_Enable: the removal is also written to EEPROM (blocking)
+ * ------------------------------------------------------- */
+bool ev1527_Forget(uint32_t _Address)
+{
+  bool _Result;
+  _Address &= EV_Address_Mask;
+  EV_Store_Sync();
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    _Result = ev1527_whitelistRemove(_Address);
+  };
+#if EV_Store_Enable
+  if(_Result) ev1527_storeSave(EV_Store_OpDel, _Address);
+#endif
+  return _Result;
+};
+
+/* -------------------------------------------------------
+ * @brief Remove all enrolled addresses
+ * @retval None
+ * @note EV_Store_Enable: writes an empty generation to EEPROM
+ * ------------------------------------------------------- */
+void ev1527_ForgetAll(void)
+{
+  EV_Store_Sync();
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    for(uint16_t _i = 0; _i < EV_Whitelist_Size; _i++) ev1527_slotWrite(_i, 0);
+    whitelistCount = 0;
+  };
+#if EV_Store_Enable
+  ev1527_storeCompact();
+#endif
+};
+
+/* -------------------------------------------------------
+ * @brief Check if a transmitter address is enrolled
+ * @param _Address: 20-bit address
+ * @retval true if enrolled
+ * ------------------------------------------------------- */
+bool ev1527_Known(uint32_t _Address)
+{
+  bool _Result;
+  EV_Store_Sync();
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    _Result = (ev1527_whitelistFind(_Address & EV_Address_Mask) != EV_Whitelist_Size);
+  };
+  return _Result;
+};
+
+/* -------------------------------------------------------
+ * @brief Enroll the next received frame (pairing mode)
+ * @param _Enable: true to arm, false to cancel
+ * @retval None
+ * ------------------------------------------------------- */
+void ev1527_LearnNext(bool _Enable)
+{
+  whitelistLearn = _Enable;
+};
+
+/* -------------------------------------------------------
+ * @brief Number of enrolled addresses
+ * @retval Enrolled count
+ * ------------------------------------------------------- */
+uint16_t ev1527_KnownCount(void)
+{
+  uint16_t _Count;
+  EV_Store_Sync();
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    _Count = whitelistCount;
+  };
+  return _Count;
+};
+#endif
+
+
+/* ============================================================================
+ *                         PULSE DECODER
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Reset decoder state machine for a new frame
+ * @param _ch: Channel context
+ * @retval None
+ * @note Called from ev1527_Init() before the capture interrupt is enabled
+ * ------------------------------------------------------- */
+static void ev1527_decoderReset(ev1527_Channel_T *_ch)
+{
+  _ch->Signal_High_Tick = 0x00;                            /**< Clear HIGH pulse measurement */
+  _ch->Signal_Low_Tick  = 0x00;                            /**< Clear LOW pulse measurement */
+  _ch->_Index = 0;                                         /**< Reset bit index to start */
+  _ch->frameBuffer = 0x0;                                  /**< Clear frame under construction */
+  _ch->preambleDetec = false;                              /**< Clear preamble detection flag */
+#if EV_Protocol_Count
+  for(uint8_t _p = 0; _p < EV_Protocol_Count; _p++) _ch->protoState[_p].Sync = false;
+#endif
+};
+
+#if EV_Stamp_Enable
+/* -------------------------------------------------------
+ * @brief Add silent Timer1 periods to the gap ended by a saturated pulse
+ * @param _ch: Channel context
+ * @param _Wraps: Full timer periods beyond the first one
+ * @retval None
+ * @note Capture context, saturates at 255 periods
+ * ------------------------------------------------------- */
+static inline void ev1527_idleAdd(ev1527_Channel_T *_ch, uint16_t _Wraps)
+{
+  uint16_t _Sum = _ch->idleWraps + _Wraps;
+  _ch->idleWraps = (_Sum > 0xFF) ? 0xFF : (uint8_t)_Sum;
+};
+
+/* -------------------------------------------------------
+ * @brief Take the silent periods counted by the capture side
+ * @param _ch: Channel context
+ * @retval Periods to add to decoderClock
+ * @note Decoder context, atomic against the capture ISR in EV_Decode_Deferred
+ * ------------------------------------------------------- */
+static inline uint8_t ev1527_idleTake(ev1527_Channel_T *_ch)
+{
+  uint8_t _Wraps;
+#if EV_Decode_Mode == EV_Decode_Deferred
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+#endif
+  {
+    _Wraps = _ch->idleWraps;
+    _ch->idleWraps = 0;
+  };
+  return _Wraps;
+};
+
+/* -------------------------------------------------------
+ * @brief Track key presses for the timestamped record of a frame
+ * @param _ch: Channel context
+ * @param _frame: Decoded frame
+ * @retval None
+ * @note Repeat: same frame, less than EV_HoldOff_Ticks after the previous
+ *       one and no silent timer period in between
+ * @note EV_Gesture_Enable: a new press of the same frame within
+ *       EV_DoubleClick_Ticks after a short single press is a double click,
+ *       a repeat EV_LongPress_Ticks after the first frame is a long press
+ * ------------------------------------------------------- */
+static void ev1527_frameStamp(ev1527_Channel_T *_ch, ev1527_frame_T _frame)
+{
+  uint32_t _Now = _ch->decoderClock;
+  uint32_t _Since = _Now - _ch->stampLast;
+  bool _Same = (_frame == _ch->stampFrame);
+  bool _Repeat = !_ch->stampGap && _Same && (_Since < EV_HoldOff_Ticks);
+
+  if(_Repeat)
+  {
+    if(_ch->stampRepeat < 0xFF) _ch->stampRepeat++;
+#if EV_Gesture_Enable
+    _ch->stampGesture = EV_Gesture_Repeat;
+    if(!_ch->gestureLong && ((_Now - _ch->stampPress) >= EV_LongPress_Ticks))
+    {
+      _ch->gestureLong = true;                             /**< Once per press */
+      _ch->gestureShort = false;                           /**< A long press does not start a double click */
+      _ch->stampGesture = EV_Gesture_Long;
+    };
+#endif
+  }
+  else
+  {
+    _ch->stampRepeat = 0;
+#if EV_Gesture_Enable
+    bool _Double = _ch->gestureShort && _Same && (_Since < EV_DoubleClick_Ticks);
+    _ch->stampGesture = _Double ? EV_Gesture_Double : EV_Gesture_Press;
+    _ch->gestureShort = !_Double;                          /**< Third click starts a new pair */
+    _ch->gestureLong = false;
+    _ch->stampPress = _Now;
+#endif
+  };
+
+  _ch->stampFrame = _frame;
+  _ch->stampLast = _Now;
+  _ch->stampGap = false;
+};
+#endif
+
+#if EV_Confirm_Enable
+/* -------------------------------------------------------
+ * @brief Repeat confirmation and duplicate suppression
+ * @param _ch: Channel context
+ * @param _frame: Decoded frame
+ * @retval true if the frame must be reported, false if it is filtered out
+ * @note A frame counts as a repeat when it equals the previous frame and
+ *       arrived less than EV_HoldOff_Ticks after it
+ * @note Reported exactly once, when the EV_Confirm_Count-th consecutive copy
+ *       arrives. Further repeats keep restarting the hold-off window and are
+ *       suppressed until the code stops for EV_HoldOff_Ticks or another code arrives.
+ * ------------------------------------------------------- */
+static bool ev1527_frameConfirm(ev1527_Channel_T *_ch, ev1527_frame_T _frame)
+{
+  bool _Repeat = (_ch->confirmCount != 0) && (_frame == _ch->confirmFrame) && ((_ch->decoderClock - _ch->confirmTime) < EV_HoldOff_Ticks);
+
+  _ch->confirmFrame = _frame;
+  _ch->confirmTime  = _ch->decoderClock;                   /**< Every copy restarts the hold-off window */
+
+  if(!_Repeat) _ch->confirmCount = 0;                      /**< New code or window expired - start counting again */
+  if(_ch->confirmCount < 0xFF) _ch->confirmCount++;
+
+  return (_ch->confirmCount == EV_Confirm_Count);
+};
+#endif
+
+/* -------------------------------------------------------
+ * @brief Deliver a complete frame to the application
+ * @param _ch: Channel context (channel number is tagged into the frame)
+ * @param _frame: Decoded frame (address in the low EV_Address_Bits, key above it)
+ * @param _proto: Protocol that decoded the frame (EV_Proto_xxx)
+ * @param _quality: Signal quality 1-7, 0 if not rated
+ * @retval None
+ * @note Passes the quality floor (EV_Quality_Min), the address whitelist (EV_Whitelist_Enable), the key press
+ *       tracking (EV_Stamp_Enable) and the repeat confirmation stage
+ *       (EV_Confirm_Enable) first
+ * @note Frame is pushed into the output queue (if enabled) and copied to ev1527_Data
+ * @note EV_Reception_Single: publish and stop the decoder (ev1527_deInit)
+ *       EV_Reception_Continuous: publish and keep the hardware running,
+ *       the state machine is already re-armed for the next frame
+ * @note EV_Callback_Direct: the registered handler is called last
+ * ------------------------------------------------------- */
+static void ev1527_framePublish(ev1527_Channel_T *_ch, ev1527_frame_T _frame, uint8_t _proto, uint8_t _quality)
+{
+  EV_Bench_Path(EV_Path_Frame);
+  EV_Stats(EV_Stats_Inc(ev1527_Stats.Frames));
+#if EV_Quality_Enable && (EV_Quality_Min > 1)
+  if(_quality && (_quality < EV_Quality_Min)) return;      /**< Marginal frame - drop, keep decoding */
+#endif
+#if EV_Whitelist_Enable
+  if(!ev1527_whitelistPass(_frame)) return;                /**< Unknown transmitter - drop, keep decoding */
+#endif
+#if EV_Stamp_Enable
+  ev1527_frameStamp(_ch, _frame);                          /**< Sees every copy, also those the repeat filter drops */
+#endif
+#if EV_Confirm_Enable
+  if(!ev1527_frameConfirm(_ch, _frame)) return;            /**< Not confirmed yet or duplicate - keep decoding */
+#endif
+
+  ev1527_T _Code = {.rawValue = _frame};
+  _Code.Bits.Detect  = true;                               /**< Set detection flag - valid code received */
+  _Code.Bits.Channel = _ch->Channel;                       /**< Tag receiver channel */
+  _Code.Bits.Protocol = _proto;                            /**< Tag decoding protocol */
+  _Code.Bits.Quality = _quality;
+  ev1527_Data.rawValue = _Code.rawValue;                   /**< Frame first ... */
+  ev1527_Data.rawTag = _Code.rawTag;                       /**< ... then the tag: Detect is set with a complete frame */
+
+#if EV_Queue_Enable
+  uint8_t _Next = (frameHead + 1) & EV_Queue_Mask;         /**< Next write position */
+  if(_Next == frameTail)                                   /**< Queue full - drop newest frame */
+  {
+    if(frameOverflow < 0xFF) frameOverflow++;
+    EV_Stats(EV_Stats_Inc(ev1527_Stats.queueOverflow));
+  }
+  else
+  {
+    frameQueue[frameHead].rawValue = _Code.rawValue;       /**< Store entry before publishing the new head */
+    frameQueue[frameHead].rawTag = _Code.rawTag;
+#if EV_Stamp_Enable
+    frameStamp[frameHead].Time = (uint16_t)(_ch->decoderClock >> EV_Stamp_Shift);
+    frameStamp[frameHead].Repeat = _ch->stampRepeat;
+#if EV_Gesture_Enable
+    frameStamp[frameHead].Gesture = _ch->stampGesture;
+#else
+    frameStamp[frameHead].Gesture = _ch->stampRepeat ? EV_Gesture_Repeat : EV_Gesture_Press;
+#endif
+#endif
+    frameHead = _Next;
+  };
+#endif
+
+#if EV_LowPower_Mode != EV_LowPower_Off
+  frameEvent = true;                                       /**< ev1527_Idle() returns instead of sleeping */
+#endif
+
+#if EV_Reception_Mode == EV_Reception_Single
+  _ch->firstTime_Trigger = true;                           /**< Reset state machine for next frame */
+  ev1527_deInit();                                         /**< Disable decoder (prevent re-triggering until manually re-enabled) */
+#endif
+
+#if EV_Callback_Enable && (EV_Callback_Mode == EV_Callback_Direct)
+  ev1527_Handler_T _Handler = frameHandler;
+  if(_Handler != NULL) _Handler(_Code);                    /**< Last: the handler may re-arm with ev1527_Init() */
+#endif
+};
+
+#if EV_Protocol_Count
+/* -------------------------------------------------------
+ * @brief Run one table protocol decoder on a complete pulse pair
+ * @param _ch: Channel context
+ * @param _p: Index into ev1527_Protocols
+ * @param _First: First pulse of the pair (HIGH, LOW for inverted protocols)
+ * @param _Second: Second pulse of the pair
+ * @retval true if the pair completed a frame that was published
+ * @note Hunting: T = (First+Second)×syncRecip/65536 must lie in the protocol's
+ *       T range and First must be syncFirst×T within ±(25% + T/2)
+ * @note Decoding: valid bit when tickHalf < First+Second < 3×tickHalf,
+ *       '1' when First ≥ tickHalf (long pulse first)
+ * ------------------------------------------------------- */
+static bool ev1527_protocolStep(ev1527_Channel_T *_ch, uint8_t _p, uint16_t _First, uint16_t _Second)
+{
+  ev1527_protoState_T *_st = &_ch->protoState[_p];
+  uint32_t _Sum = (uint32_t)_First + _Second;              /**< 32-bit: two long pulses may exceed 16 bits */
+
+  if((_First == EV_Tick_Overflow) || (_Second == EV_Tick_Overflow))
+  {
+    _st->Sync = false;                                     /**< Saturated pulse - never part of a frame */
+    return false;
+  };
+
+  if(_st->Sync)                                            /**< Sync found - decode data bits */
+  {
+    if((_Sum > _st->tickHalf) && (_Sum < _st->tickMax))
+    {
+      _st->Buffer >>= 1;                                   /**< Constant shift - no per-bit variable shift */
+      if(_First >= _st->tickHalf) _st->Buffer |= 0x80000000UL;  /**< Long first pulse → '1' */
+      _st->Index++;
+
+      uint8_t _bitCount = EV_Proto_Byte(_p, bitCount);
+      if(_st->Index >= _bitCount)                          /**< All bits received */
+      {
+        uint32_t _Frame = _st->Buffer >> (32 - _bitCount);  /**< First bit to bit 0 - once per frame */
+        _st->Sync = false;
+
+        if((EV_Proto_Byte(_p, Flags) & EV_ProtoFlag_TriState) && ((_Frame & ~(_Frame >> 1)) & 0x555555UL)) return false;  /**< Pair '10' is not a tri-state symbol */
+
+        if(_bitCount != EV_Data_Bits)                      /**< Last EV_Key_Bits bits are the keys - move them above the address */
+        {
+          uint8_t _addrBits = _bitCount - EV_Key_Bits;
+          _Frame = (_Frame & ((1UL << _addrBits) - 1)) | ((_Frame >> _addrBits) << EV_Address_Bits);
+        };
+        ev1527_framePublish(_ch, (ev1527_frame_T)_Frame, EV_Proto_Byte(_p, Protocol), 0);  /**< Table protocols are not rated */
+        return true;
+      };
+      return false;                                        /**< Pair consumed as data bit */
+    };
+    _st->Sync = false;                                     /**< Invalid bit - this pair may be the next sync */
+  };
+
+  /* Hunting: estimate T from the sync pair (also on the pair that broke a frame) */
+  uint16_t _T = (uint16_t)((_Sum * EV_Proto_Word(_p, syncRecip)) >> 16);
+  if((_T < EV_Proto_Word(_p, tickT_min)) || (_T > EV_Proto_Word(_p, tickT_Max))) return false;
+
+  uint16_t _Nominal = EV_Proto_Byte(_p, syncFirst) * _T;
+  uint16_t _Error = (_First > _Nominal) ? (_First - _Nominal) : (_Nominal - _First);
+  if(_Error > ((_Nominal >> 2) + (_T >> 1))) return false;  /**< First pulse does not match the sync shape */
+
+  _st->tickHalf = (uint16_t)((EV_Proto_Byte(_p, bitUnits) * (uint32_t)_T) >> 1);
+  _st->tickMax  = 3 * _st->tickHalf;
+  _st->Index = 0;
+  _st->Buffer = 0x0;
+  _st->Sync = true;
+  return false;
+};
+
+/* -------------------------------------------------------
+ * @brief Feed one pulse pair to every table protocol of matching polarity
+ * @param _ch: Channel context
+ * @param _First: First pulse of the pair
+ * @param _Second: Second pulse of the pair
+ * @param _Flags: EV_ProtoFlag_Inverted for LOW+HIGH pairs, 0 for HIGH+LOW pairs
+ * @retval true if a protocol published a frame (all decoders of the channel restarted)
+ * @note The table is constant and in flash, the loop is resolved at compile
+ *       time for small tables; disabled protocols have no entry
+ * ------------------------------------------------------- */
+static bool ev1527_protocolHandler(ev1527_Channel_T *_ch, uint16_t _First, uint16_t _Second, uint8_t _Flags)
+{
+  for(uint8_t _p = 0; _p < EV_Protocol_Count; _p++)
+  {
+    if((EV_Proto_Byte(_p, Flags) & EV_ProtoFlag_Inverted) != _Flags) continue;
+    if(ev1527_protocolStep(_ch, _p, _First, _Second))
+    {
+      for(uint8_t _q = 0; _q < EV_Protocol_Count; _q++) _ch->protoState[_q].Sync = false;
+      _ch->preambleDetec = false;                          /**< Frame claimed - EV1527 decoder restarts too */
+      return true;
+    };
+  };
+  return false;
+};
+#endif
+
+#if EV_Quality_Enable
+/* -------------------------------------------------------
+ * @brief Accumulate the quality errors of one decoded EV1527 bit
+ * @param _ch: Channel context
+ * @param _High: HIGH pulse of the bit
+ * @param _Low: LOW pulse of the bit
+ * @param _Bit: Decoded bit value
+ * @retval None
+ * @note Split error |HIGH - ideal share| plus half the period error
+ *       |bit - first bit|, both in ticks; the counters restart at the preamble
+ * ------------------------------------------------------- */
+static inline void ev1527_qualityBit(ev1527_Channel_T *_ch, uint16_t _High, uint16_t _Low, uint8_t _Bit)
+{
+  uint16_t _Sum = _High + _Low;                            /**< Both below the bit window, fits 16 bits */
+  uint16_t _Quarter = _Sum >> 2;
+  uint16_t _Ideal = _Bit ? (_Sum - _Quarter) : _Quarter;   /**< 3T or 1T of 4T */
+  uint16_t _Split = (_High > _Ideal) ? (_High - _Ideal) : (_Ideal - _High);
+
+  if(_ch->qualitySum == 0) _ch->qualityRef = _Sum;         /**< First measured bit of the frame */
+  uint16_t _Period = (_Sum > _ch->qualityRef) ? (_Sum - _ch->qualityRef) : (_ch->qualityRef - _Sum);
+
+  _ch->qualityErr += _Split + (_Period >> 1);
+  _ch->qualitySum += _Sum;
+};
+
+/* -------------------------------------------------------
+ * @brief Quality of the complete frame
+ * @param _ch: Channel context
+ * @retval 7 - mean error in 1/32 of a bit, limited to 1..7
+ * @note Repeated subtraction instead of a 32-bit division (ISR context)
+ * ------------------------------------------------------- */
+static uint8_t ev1527_qualityScore(ev1527_Channel_T *_ch)
+{
+  uint32_t _Step = _ch->qualitySum >> 5;                   /**< 1/32 of the mean bit, summed over the frame */
+  uint32_t _Err = _ch->qualityErr;
+  uint8_t _Score = 7;
+  while((_Score > 1) && (_Err >= _Step))
+  {
+    _Err -= _Step;
+    _Score--;
+  };
+  return _Score;
+};
+#endif
+
+#if EV_Soft_Enable
+/* -------------------------------------------------------
+ * @brief Discard the merged votes
+ * @param _ch: Channel context
+ * @retval None
+ * ------------------------------------------------------- */
+static void ev1527_softClear(ev1527_Channel_T *_ch)
+{
+  for(uint8_t _n = 0; _n <= EV_maxIndexData; _n++) _ch->softVotes[_n] = 0;
+  _ch->softFrames = 0;
+  _ch->softGap = 0;
+};
+
+/* -------------------------------------------------------
+ * @brief Check a frame against the settled vote positions
+ * @param _ch: Channel context
+ * @param _Bits: Frame bits, bit 0 first
+ * @param _Soft: Erased or ambiguous bits of the frame
+ * @retval true if a decided bit opposes a confirmed position (another code)
+ * ------------------------------------------------------- */
+static bool ev1527_softConflict(ev1527_Channel_T *_ch, ev1527_frame_T _Bits, ev1527_frame_T _Soft)
+{
+  for(uint8_t _n = 0; _n <= EV_maxIndexData; _n++)
+  {
+    int8_t _Vote = _ch->softVotes[_n];
+    if(!(_Soft & 0x01) && ((_Bits & 0x01) ? (_Vote <= -EV_Soft_Margin) : (_Vote >= EV_Soft_Margin))) return true;
+    _Bits >>= 1;
+    _Soft >>= 1;
+  };
+  return false;
+};
+
+/* -------------------------------------------------------
+ * @brief Mark the bit just shifted in as an erasure
+ * @param _ch: Channel context
+ * @retval None
+ * ------------------------------------------------------- */
+static inline void ev1527_softErase(ev1527_Channel_T *_ch)
+{
+  _ch->softErase |= EV_Frame_Top;                          /**< Same position as the frameBuffer bit */
+  EV_Stats(EV_Stats_Inc(ev1527_Stats.Erasures));
+};
+
+/* -------------------------------------------------------
+ * @brief Merge a complete frame into the votes
+ * @param _ch: Channel context
+ * @param _Frame: Destination for the voted frame
+ * @retval true if every bit position is confirmed (_Frame valid)
+ * @note A decided bit adds 2, an ambiguous bit 1, an erasure 0 (sign = bit value);
+ *       a position is confirmed at a margin of EV_Soft_Margin
+ * @note A clean frame (no erasure, no ambiguous bit) is taken as it is and
+ *       ends the pending votes. A decided bit against a confirmed position
+ *       means another code: the votes restart with this frame
+ * ------------------------------------------------------- */
+static bool ev1527_softVote(ev1527_Channel_T *_ch, ev1527_frame_T *_Frame)
+{
+  ev1527_frame_T _Bits = _ch->frameBuffer;
+  ev1527_frame_T _Erase = _ch->softErase;
+  ev1527_frame_T _Weak = _ch->softWeak;
+  if((_Erase | _Weak) == 0)
+  {
+    if(_ch->softFrames) ev1527_softClear(_ch);
+    *_Frame = _Bits;
+    return true;
+  };
+  if(_ch->softFrames && ev1527_softConflict(_ch, _Bits, _Erase | _Weak)) ev1527_softClear(_ch);
+
+  ev1527_frame_T _Voted = 0;
+  bool _Done = true;
+  for(uint8_t _n = 0; _n <= EV_maxIndexData; _n++)
+  {
+    int8_t _Vote = _ch->softVotes[_n];
+    if(!(_Erase & 0x01))
+    {
+      int8_t _Weight = (_Weak & 0x01) ? 1 : 2;             /**< Ambiguous split: half a vote */
+      if(_Bits & 0x01) _Vote = (_Vote > (125 - 2)) ? 125 : (_Vote + _Weight);
+      else             _Vote = (_Vote < (2 - 125)) ? -125 : (_Vote - _Weight);
+      _ch->softVotes[_n] = _Vote;
+    };
+    _Voted >>= 1;                                          /**< Shift accumulator, bit 0 first */
+    if(_Vote >= EV_Soft_Margin) _Voted |= EV_Frame_Top;
+    else if(_Vote > -EV_Soft_Margin) _Done = false;        /**< Position not confirmed yet */
+    _Bits >>= 1;
+    _Erase >>= 1;
+    _Weak >>= 1;
+  };
+
+  if(_Done || (++_ch->softFrames >= EV_Soft_Repeats)) ev1527_softClear(_ch);  /**< Published or given up */
+  _ch->softGap = 0;                                        /**< Next repeat is timed from here */
+  *_Frame = _Voted;
+  return _Done;
+};
+#endif
+
+/* -------------------------------------------------------
+ * @brief Preamble accepted - start collecting data bits
+ * @param _ch: Channel context
+ * @retval None
+ * ------------------------------------------------------- */
+static inline void ev1527_frameStart(ev1527_Channel_T *_ch)
+{
+  _ch->preambleDetec = true;                               /**< Set preamble detection flag - ready to decode data */
+  _ch->_Index = 0;                                         /**< Data bits start right after the preamble */
+#if EV_Soft_Enable
+  _ch->softErasures = 0;
+  if(_ch->softFrames)
+  {
+    uint32_t _Sync = (uint32_t)_ch->Signal_High_Tick + _ch->Signal_Low_Tick;  /**< This preamble: the repeat spacing */
+    if(_ch->softGap > (_Sync + (_Sync >> 2))) ev1527_softClear(_ch);  /**< More than the spacing since the last frame - a new press */
+  };
+#endif
+#if EV_Quality_Enable
+  _ch->qualityErr = 0;
+  _ch->qualitySum = 0;
+#endif
+  EV_Stats(EV_Stats_Inc(ev1527_Stats.Preambles));
+  EV_Bench_Path(EV_Path_Preamble);
+};
+
+/* -------------------------------------------------------
+ * @brief All EV_Data_Bits bit slots of an EV1527 frame received
+ * @param _ch: Channel context
+ * @retval None
+ * @note EV_Soft_Enable: publishes only when the votes confirm every bit
+ * ------------------------------------------------------- */
+static void ev1527_frameComplete(ev1527_Channel_T *_ch)
+{
+  ev1527_frame_T _Frame = _ch->frameBuffer;
+  _ch->preambleDetec = false;                              /**< Clear preamble flag - hunt for the next frame */
+#if EV_Protocol_Count
+  for(uint8_t _p = 0; _p < EV_Protocol_Count; _p++) _ch->protoState[_p].Sync = false;
+#endif
+#if EV_Soft_Enable
+  if(!ev1527_softVote(_ch, &_Frame)) return;               /**< Wait for more repeats */
+#endif
+#if EV_Quality_Enable
+  ev1527_framePublish(_ch, _Frame, EV_Proto_EV1527, ev1527_qualityScore(_ch));  /**< Hand complete frame to the application */
+#else
+  ev1527_framePublish(_ch, _Frame, EV_Proto_EV1527, 0);    /**< Hand complete frame to the application */
+#endif
+};
+
+/* -------------------------------------------------------
+ * @brief Process one measured pulse (HIGH or LOW level)
+ * @param _ch: Channel context
+ * @param _tick: Pulse duration in timer ticks (EV_Tick_Overflow if saturated)
+ * @param _level: Level of the pulse that just ended (EV_Level_High / EV_Level_Low)
+ * @retval None
+ * @note A HIGH pulse is stored, the following LOW pulse completes the
+ *       HIGH+LOW pair which is then checked for preamble or decoded as a bit
+ * @note Independent of the capture backend (INT0, ICP1 or shared timebase)
+ * @note Runs in ISR context (EV_Decode_ISR) or from ev1527_Process() (EV_Decode_Deferred)
+ * ------------------------------------------------------- */
+static void ev1527_pulseHandler(ev1527_Channel_T *_ch, uint16_t _tick, uint8_t _level)
+{
+#if EV_Clock_Enable
+  _ch->decoderClock += _tick;                              /**< Advance decoder timebase */
+  if(_tick >= EV_Tick_Overflow)                            /**< Line idle for a full timer period - not a repeat burst */
+  {
+#if EV_Confirm_Enable
+    _ch->confirmCount = 0;
+#endif
+#if EV_Stamp_Enable
+    _ch->decoderClock += ev1527_idleTake(_ch) * EV_Timer_Period;  /**< Rest of the silent gap */
+    _ch->stampGap = true;
+#endif
+  };
+#endif
+#if EV_Soft_Enable
+  if(_ch->softFrames)
+  {
+    if(_tick >= EV_Tick_Overflow) ev1527_softClear(_ch);  /**< Silent line - next frames belong to a new press */
+    else _ch->softGap = (_tick > (0xFFFF - _ch->softGap)) ? 0xFFFF : (_ch->softGap + _tick);
+  };
+#endif
+
+  /* HIGH pulse finished - wait for the LOW pulse to complete the pair */
+  if(_level == EV_Level_High)
+  {
+    EV_Bench_Path(EV_Path_High);
+    _ch->Signal_High_Tick = _tick;                         /**< Capture HIGH pulse duration */
+#if EV_Protocol_Count
+    ev1527_protocolHandler(_ch, _ch->Signal_Low_Tick, _tick, EV_ProtoFlag_Inverted);  /**< LOW+HIGH pair complete */
+#endif
+    return;
+  };
+
+  uint16_t _High = _ch->Signal_High_Tick;
+  uint16_t _Low  = _tick;                                  /**< Capture LOW pulse duration - complete HIGH+LOW pulse */
+  _ch->Signal_Low_Tick = _Low;
+
+#if EV_Protocol_Count
+  if(ev1527_protocolHandler(_ch, _High, _Low, 0)) return;  /**< Claimed by a table protocol */
+#endif
+
+  /* Check if preamble already detected */
+  if(_ch->preambleDetec)                                   /**< Preamble found - decode data bits */
+  {
+#if EV_Adaptive_T
+    /* Validate pulse timing: fixed window, then the window of this frame's T
+       once the first EV_Adaptive_Learn bits have refined the estimate */
+    uint16_t _Sum = _Low + _High;                          /**< No wrap: _Low and _High are below HPL_Max here */
+    uint16_t _T = _ch->frameTick_Ref >> 2;
+    if(EV_pulseIsValid(_Low, _High) && ((_ch->_Index < EV_Adaptive_Learn) || ((_Sum > (EV_Adaptive_MinT * _T)) && (_Sum < (EV_Adaptive_MaxT * _T)))))
+    {
+      _ch->frameTick_Ref += ((int16_t)(_Sum - _ch->frameTick_Ref)) >> 3;  /**< Running average of the bit length, 1/8 per bit */
+      /* Decode bit and store in result */
+      uint8_t _Bit = EV_bitCheck(_Low, _High);             /**< Decode bit: 2×HIGH≥3×LOW → '1', else '0' (same as the fixed window) */
+#else
+    /* Validate pulse timing is within acceptable range */
+    if(EV_pulseIsValid(_Low, _High))                       /**< Check if pulse duration is valid (HPL_min-HPL_Max) */
+    {
+      /* Decode bit and store in result */
+      uint8_t _Bit = EV_bitCheck(_Low, _High);             /**< Decode bit: 2×HIGH≥3×LOW → '1', else '0' */
+#endif
+      _ch->frameBuffer >>= 1;                              /**< First bit ends in bit 0 after EV_Data_Bits shifts */
+      if(_Bit) _ch->frameBuffer |= EV_Frame_Top;
+#if EV_Soft_Enable
+      _ch->softErase >>= 1;
+      _ch->softWeak >>= 1;
+      if(((_High + (_High >> 2)) > _Low) && ((_Low + (_Low >> 2)) > _High)) _ch->softWeak |= EV_Frame_Top;  /**< Ambiguous split (within 1.25x) - half a vote */
+#endif
+#if EV_Quality_Enable
+      ev1527_qualityBit(_ch, _High, _Low, _Bit);
+#endif
+      _ch->_Index++;                                       /**< Move to next bit position */
+      EV_Bench_Path(EV_Path_Bit);
+
+      /* Check if all data bits received */
+      if(_ch->_Index > EV_maxIndexData) ev1527_frameComplete(_ch);  /**< Compile-time constant: all EV_Data_Bits received */
+      return;                                              /**< Pair consumed as data bit */
+    };
+
+#if EV_Soft_Enable
+    /* Broken bit inside the frame: keep it as an erasure, a preamble
+       or a saturated pulse still ends the frame */
+    if((_High != EV_Tick_Overflow) && (_Low != EV_Tick_Overflow) && !EV_PrembleCheck(_Low, _High) && (_ch->softErasures < EV_Soft_MaxErasures))
+    {
+      _ch->frameBuffer >>= 1;
+      _ch->softErase >>= 1;
+      _ch->softWeak >>= 1;
+      ev1527_softErase(_ch);
+      _ch->softErasures++;                                 /**< Only broken timing counts against the limit */
+      _ch->_Index++;
+      EV_Bench_Path(EV_Path_Bit);
+      if(_ch->_Index > EV_maxIndexData) ev1527_frameComplete(_ch);
+      return;                                              /**< Pair consumed as erasure */
+    };
+#endif
+
+    /* Invalid pulse timing: abort the frame, but the same pair may already
+       be the sync of a new transmission - fall through to the preamble hunt */
+    _ch->preambleDetec = false;                            /**< Clear preamble flag */
+    EV_Bench_Path(EV_Path_Abort);
+#if EV_Stats_Enable
+    EV_Stats_Inc(ev1527_Stats.Aborts);
+    if(ev1527_Stats.abortIndex[_ch->_Index] != 0xFF) ev1527_Stats.abortIndex[_ch->_Index]++;
+#endif
+  };
+
+  /* Hunt for a preamble on every pair that is not a valid data bit */
+  if(EV_PrembleCheck(_Low, _High))                         /**< Validate preamble pattern (LOW 25-40× HIGH) */
+  {
+#if EV_Adaptive_T
+    /* Preamble HIGH+LOW spans 32×T: estimate T with shifts only */
+    uint16_t _T = (_High >> 5) + (_Low >> 5);
+    if((_T >= EV_Tick_T_min) && (_T <= EV_Tick_T_Max))     /**< Plausible base period */
+    {
+      _ch->frameTick_Ref = _T << 2;                        /**< First estimate of the bit length (4T) */
+      ev1527_frameStart(_ch);
+    };
+#else
+    ev1527_frameStart(_ch);
+#endif
+  };
+};
+
+
+#if EV_Bench_Enable
+/* -------------------------------------------------------
+ * @brief Record one timed decoder call
+ * @param _Path: EV_Path_xxx taken by the call
+ * @param _Ticks: Duration in Timer1 ticks
+ * @param _Fine: Duration modulo 256 cycles from Timer0 (EV_Bench_Exact only)
+ * @retval None
+ * @note EV_Bench_Exact: Timer1 places the call within one prescaler step of
+ *       its length, the Timer0 byte corrects the low bits. With a step of at
+ *       most 64 cycles the correction stays inside a signed byte
+ * ------------------------------------------------------- */
+static void ev1527_benchRecord(uint8_t _Path, uint16_t _Ticks, uint8_t _Fine)
+{
+  ev1527_Bench_T *_b = &benchPaths[_Path];
+  uint32_t _Long = (uint32_t)_Ticks * EV_Bench_CyclesPerTick;
+#if EV_Bench_Exact
+  _Long += (int8_t)(uint8_t)(_Fine - (uint8_t)_Long);      /**< Coarse estimate +- one step, low byte from Timer0 */
+  if((int32_t)_Long < 0) _Long = 0;
+#endif
+  uint16_t _Cycles = (_Long > 0xFFFF) ? 0xFFFF : (uint16_t)_Long;
+  uint16_t _Bin = _Cycles / EV_Bench_BinCycles;
+
+  if(_Bin >= EV_Bench_Bins) _Bin = EV_Bench_Bins - 1;      /**< Last bin is open ended */
+  if((_b->Count == 0) || (_Cycles < _b->Min)) _b->Min = _Cycles;
+  if(_Cycles > _b->Max) _b->Max = _Cycles;
+  if(_b->Count != 0xFFFF)                                  /**< Sum stays consistent with Count */
+  {
+    _b->Count++;
+    _b->Sum += _Cycles;
+  };
+  if(_b->Histogram[_Bin] != 0xFFFF) _b->Histogram[_Bin]++;
+};
+#endif
+
+/* -------------------------------------------------------
+ * @brief Run the decoder on one pulse
+ * @param _ch: Channel context
+ * @param _tick: Pulse duration in timer ticks
+ * @param _level: Level of the pulse that just ended
+ * @retval None
+ * @note EV_Bench_Enable: the call is timed on Timer1 and recorded under
+ *       the path the state machine took
+ * ------------------------------------------------------- */
+static inline void ev1527_pulseDecode(ev1527_Channel_T *_ch, uint16_t _tick, uint8_t _level)
+{
+#if EV_Bench_Enable
+#if EV_Bench_Exact
+  uint8_t _Start0 = TCNT0;                                 /**< Same read order at both ends: offsets cancel */
+#else
+  uint8_t _Start0 = 0;
+#endif
+  uint16_t _Start = EV_Timer_Value;
+  benchPath = EV_Path_Hunt;                                /**< Default: pair neither bit nor preamble */
+  ev1527_pulseHandler(_ch, _tick, _level);
+#if EV_Bench_Exact
+  uint8_t _Stop0 = TCNT0;
+#else
+  uint8_t _Stop0 = 0;
+#endif
+  ev1527_benchRecord(benchPath, EV_Timer_Delta(EV_Timer_Value, _Start), (uint8_t)(_Stop0 - _Start0));
+#else
+  ev1527_pulseHandler(_ch, _tick, _level);
+#endif
+};
+
+/* -------------------------------------------------------
+ * @brief Hand one captured pulse to the decoder
+ * @param _ch: Channel context
+ * @param _tick: Pulse duration in timer ticks
+ * @param _level: Level of the pulse that just ended
+ * @retval None
+ * @note EV_Decode_ISR: decodes immediately in interrupt context
+ *       EV_Decode_Deferred: only pushes a packed 16-bit entry into the
+ *       channel's lock-free ring buffer, decoding runs later in ev1527_Process()
+ * @note On a full buffer the pulse is dropped and a gap marker is queued
+ *       as soon as there is room, so the decoder never pairs pulses across a gap
+ * ------------------------------------------------------- */
+static inline void ev1527_pulseDeliver(ev1527_Channel_T *_ch, uint16_t _tick, uint8_t _level)
+{
+#if EV_Decode_Mode == EV_Decode_ISR
+  ev1527_pulseDecode(_ch, _tick, _level);                  /**< Decode in ISR context */
+#else
+  uint8_t _Head = _ch->pulseHead;
+  uint8_t _Next = (_Head + 1) & EV_pulseBuffer_Mask;       /**< Next write position */
+
+  if(_ch->pulseLost)                                       /**< Previous pulse(s) dropped - mark the gap first */
+  {
+    if(_Next == _ch->pulseTail) return;                    /**< Still full - keep dropping */
+    _ch->pulseBuffer[_Head] = EV_Pulse_Gap;
+    _Head = _Next;
+    _Next = (_Next + 1) & EV_pulseBuffer_Mask;
+    _ch->pulseHead = _Head;
+    _ch->pulseLost = false;
+  };
+
+  if(_Next == _ch->pulseTail)                              /**< Buffer full - drop pulse */
+  {
+    _ch->pulseLost = true;
+    EV_Stats(EV_Stats_Inc(ev1527_Stats.pulseDropped));
+    return;
+  };
+
+  _ch->pulseBuffer[_Head] = (_tick & 0xFFFE) | _level;     /**< Store entry before publishing the new head */
+  _ch->pulseHead = _Next;
+#endif
+};
+
+#if EV_Glitch_Enable
+/* -------------------------------------------------------
+ * @brief Glitch filter: merge pulses shorter than EV_Glitch_Ticks
+ * @param _ch: Channel context
+ * @param _tick: Pulse duration in timer ticks
+ * @param _level: Level of the pulse that just ended
+ * @retval None
+ * @note The last pulse is held back. A glitch is added to it; the next long
+ *       pulse is added too when it has the held level (the glitch only cut it
+ *       in two), otherwise the held pulse is delivered and the new one held.
+ * @note Sums saturate at EV_Tick_Overflow
+ * ------------------------------------------------------- */
+static inline void ev1527_glitchFilter(ev1527_Channel_T *_ch, uint16_t _tick, uint8_t _level)
+{
+  uint8_t _Held = _ch->glitchLevel;
+
+  if((_tick < EV_Glitch_Ticks) || (_level == _Held))       /**< Glitch, or second half of a cut pulse */
+  {
+    if(_Held == EV_Glitch_None) return;                    /**< Nothing to merge into - discard */
+    uint16_t _Sum = _ch->glitchTick + _tick;
+    _ch->glitchTick = (_Sum < _tick) ? EV_Tick_Overflow : _Sum;
+#if EV_Stats_Enable
+    if(_tick < EV_Glitch_Ticks) EV_Stats_Inc(ev1527_Stats.Glitches);
+#endif
+    return;
+  };
+
+  if(_Held != EV_Glitch_None) ev1527_pulseDeliver(_ch, _ch->glitchTick, _Held);  /**< Confirmed: not cut by a glitch */
+  _ch->glitchTick = _tick;
+  _ch->glitchLevel = _level;
+};
+#endif
+
+#if EV_Storm_Enable
+/* -------------------------------------------------------
+ * @brief Mask the edge interrupt and start the back-off / sampling timer
+ * @retval None
+ * @note Called from the capture ISR; Timer1 compare A fires every
+ *       EV_Storm_Sample_Ticks from now on
+ * ------------------------------------------------------- */
+static void ev1527_stormBegin(void)
+{
+#if EV_Capture_Mode == EV_Capture_INT0
+  bitClear(EIMSK, INT0);                                   /**< No more edge interrupts */
+#else
+  bitClear(TIMSK1, ICIE1);
+#endif
+  stormHold = EV_Storm_Backoff_Samples;
+  stormQuiet = 0;
+  OCR1A = EV_Timer_Value + EV_Storm_Sample_Ticks;
+  TIFR1 = (1 << OCF1A);                                    /**< Clear stale compare flag */
+  bitSet(TIMSK1, OCIE1A);
+  EV_Stats(EV_Stats_Inc(ev1527_Stats.Storms));
+};
+
+/* -------------------------------------------------------
+ * @brief Count one edge against the storm threshold
+ * @param _tick: Duration of the pulse that ended at this edge
+ * @retval true if the edge interrupt was masked (pulse dropped)
+ * @note Only additions and compares: the window is signal time, summed
+ *       from the measured pulses, no timer is read
+ * ------------------------------------------------------- */
+static inline bool ev1527_stormCheck(uint16_t _tick)
+{
+  uint16_t _Ticks = stormTicks + _tick;
+  if((_Ticks < _tick) || (_Ticks >= EV_Storm_Window_Ticks))  /**< Window over (a preamble gap always ends it) */
+  {
+    stormTicks = 0;
+    stormEdges = 0;
+    return false;
+  };
+  stormTicks = _Ticks;
+  if(++stormEdges < EV_Storm_Edges) return false;
+
+  stormTicks = 0;
+  stormEdges = 0;
+  ev1527_stormBegin();
+  return true;
+};
+#endif
+
+/* -------------------------------------------------------
+ * @brief Front-end stages between the capture backend and the decoder
+ * @param _ch: Channel context
+ * @param _tick: Pulse duration in timer ticks
+ * @param _level: Level of the pulse that just ended
+ * @retval None
+ * @note EV_Storm_Enable: noise storm limiter (may mask the edge interrupt)
+ *       EV_Glitch_Enable: glitch filter
+ * ------------------------------------------------------- */
+static inline void ev1527_pulseFilter(ev1527_Channel_T *_ch, uint16_t _tick, uint8_t _level)
+{
+#if EV_Storm_Enable
+  if(ev1527_stormCheck(_tick)) return;                     /**< Noise storm - edge interrupt masked */
+#endif
+#if EV_Glitch_Enable
+  ev1527_glitchFilter(_ch, _tick, _level);
+#else
+  ev1527_pulseDeliver(_ch, _tick, _level);
+#endif
+};
+
+/* -------------------------------------------------------
+ * @brief Entry point of every capture ISR for one measured pulse
+ * @param _ch: Channel context
+ * @param _tick: Pulse duration in timer ticks
+ * @param _level: Level of the pulse that just ended
+ * @retval None
+ * @note EV_Raw_Enable: pulses of the raw capture channel are recorded into
+ *       rawBuffer (unfiltered) and never reach the decoder
+ * @note Other pulses pass the noise storm limiter and glitch filter first
+ * @note EV_Debug_Enable: PC0 is HIGH while the pulse is handled
+ * @note EV_Stats_Enable: the handling time is measured on Timer1 and the
+ *       maximum kept in ev1527_Stats.isrMax (interrupt entry and the
+ *       timer read of the backend are not included, not measured with
+ *       EV_Capture_Software)
+ * ------------------------------------------------------- */
+static inline void ev1527_pulseCapture(ev1527_Channel_T *_ch, uint16_t _tick, uint8_t _level)
+{
+#if EV_Debug_Enable
+  bitSet(PORTC, EV_Debug_Bit);
+#endif
+#if EV_Stats_Enable && (EV_Capture_Mode != EV_Capture_Software)
+  uint16_t _Start = EV_Timer_Value;                        /**< Timer1 counts on (stopped at most by ev1527_deInit) */
+#endif
+#if EV_Raw_Enable
+  if(_ch->Channel == rawChannel)                           /**< Raw capture: record only */
+  {
+    uint16_t _Count = rawCount;
+    if(_Count < EV_Raw_Size)                               /**< Full buffer stops recording */
+    {
+      rawBuffer[_Count] = (_tick & 0xFFFE) | _level;       /**< Same packing as the deferred ring */
+      rawCount = _Count + 1;
+    };
+  }
+  else
+#endif
+  {
+    ev1527_pulseFilter(_ch, _tick, _level);
+  };
+#if EV_Stats_Enable && (EV_Capture_Mode != EV_Capture_Software)
+  uint16_t _Spent = EV_Timer_Delta(EV_Timer_Value, _Start);
+  if(_Spent > ev1527_Stats.isrMax) ev1527_Stats.isrMax = _Spent;
+#endif
+#if EV_Debug_Enable
+  bitClear(PORTC, EV_Debug_Bit);
+#endif
+};
+
+#if EV_Capture_Mode == EV_Capture_Shared
+/* -------------------------------------------------------
+ * @brief Timestamp one edge of a channel on the shared free-running timebase
+ * @param _ch: Channel context
+ * @param _pin: Pin level read right after the edge (0 or non-zero)
+ * @retval None
+ * @note Timer1 is never written: duration = TCNT1 - previous TCNT1 of this channel
+ *       (modulo EV_Timer_Top + 1 when the application owns Timer1).
+ *       The overflow epoch extends the counter; more than one full timer
+ *       period between edges saturates the pulse to EV_Tick_Overflow.
+ * @note The ended pulse has the opposite level of the pin. If the pin reads the
+ *       same level as after the previous edge, two edges of a glitch were merged
+ *       into one interrupt and the edge is ignored.
+ * ------------------------------------------------------- */
+static inline void ev1527_edgeCapture(ev1527_Channel_T *_ch, uint8_t _pin)
+{
+  uint16_t _Stamp = EV_Timer_Value;                        /**< Shared timebase, read only */
+  uint16_t _Epoch = timerEpoch;
+  uint8_t _Level  = _pin ? EV_Level_Low : EV_Level_High;   /**< Pin HIGH now → a LOW pulse just ended */
+
+  if(bitCheck(TIFR1, TOV1) && (_Stamp < EV_Timer_Half)) _Epoch++;  /**< Overflow pending (not yet serviced) before the read */
+
+  if(_Level == _ch->lastLevel) return;                     /**< No level change since previous edge - merged glitch */
+
+  uint16_t _Tick = EV_Timer_Delta(_Stamp, _ch->lastStamp);  /**< Pulse duration in timer ticks */
+  uint16_t _Wrap = _Epoch - _ch->lastEpoch;
+  if((_Wrap > 1) || ((_Wrap == 1) && (_Stamp >= _ch->lastStamp)))
+  {
+    _Tick = EV_Tick_Overflow;                              /**< More than 16 bits elapsed - saturate */
+#if EV_Stamp_Enable
+    ev1527_idleAdd(_ch, _Wrap - 1);                        /**< Further silent periods for the decoder clock */
+#endif
+  };
+
+  _ch->lastStamp = _Stamp;
+  _ch->lastEpoch = _Epoch;
+  _ch->lastLevel = _Level;
+
+  if(_ch->firstTime_Trigger)                               /**< First edge only provides the start timestamp */
+  {
+    _ch->firstTime_Trigger = false;
+    return;
+  };
+
+  ev1527_pulseCapture(_ch, _Tick, _Level);
+};
+#endif
+
+
+#if EV_Raw_Enable
+/* ============================================================================
+ *                         RAW PULSE CAPTURE
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Start raw capture on one channel
+ * @param _Channel: Channel index (0 to EV_Channel_Count-1)
+ * @retval None
+ * ------------------------------------------------------- */
+void ev1527_RawStart(uint8_t _Channel)
+{
+  if(_Channel >= EV_Channel_Count) return;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    rawCount = 0;
+    rawChannel = _Channel;
+  };
+};
+
+/* -------------------------------------------------------
+ * @brief Stop raw capture and resume decoding
+ * @retval None
+ * @note The decoder of the channel restarts from preamble search, it never
+ *       pairs a pulse from before the raw capture with one after it
+ * ------------------------------------------------------- */
+void ev1527_RawStop(void)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    uint8_t _Channel = rawChannel;
+    rawChannel = EV_Raw_Off;
+    if(_Channel < EV_Channel_Count)
+    {
+#if EV_Glitch_Enable
+      ev1527_Channels[_Channel].glitchLevel = EV_Glitch_None;  /**< Held pulse predates the raw capture */
+#endif
+#if EV_Decode_Mode == EV_Decode_Deferred
+      ev1527_Channels[_Channel].pulseLost = true;          /**< Gap marker ahead of the next pulse */
+#else
+      ev1527_decoderReset(&ev1527_Channels[_Channel]);
+#endif
+    };
+  };
+};
+
+/* -------------------------------------------------------
+ * @brief Number of pulses in the raw buffer
+ * @retval 0 to EV_Raw_Size
+ * ------------------------------------------------------- */
+uint16_t ev1527_RawCount(void)
+{
+  uint16_t _Count;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    _Count = rawCount;                                     /**< 16-bit read, written by the capture ISR */
+  };
+  return _Count;
+};
+
+#if EV_Raw_UART
+/* -------------------------------------------------------
+ * @brief Built-in dump sink: blocking USART0 transmit
+ * @param _Byte: Byte to send
+ * @retval None
+ * ------------------------------------------------------- */
+static void ev1527_rawPutUART(uint8_t _Byte)
+{
+  while(!bitCheck(UCSR0A, UDRE0));                         /**< Wait for an empty transmit buffer */
+  UDR0 = _Byte;
+};
+#endif
+
+/* -------------------------------------------------------
+ * @brief Send one dump byte and fold it into the running CRC
+ * @param _Put: Byte sink
+ * @param _CRC: CRC16 so far
+ * @param _Byte: Byte to send
+ * @retval Updated CRC16
+ * ------------------------------------------------------- */
+static uint16_t ev1527_rawSend(ev1527_RawPut_T _Put, uint16_t _CRC, uint8_t _Byte)
+{
+  _Put(_Byte);
+  return _crc16_update(_CRC, _Byte);
+};
+
+/* -------------------------------------------------------
+ * @brief Stream the raw buffer in binary dump format
+ * @param _Put: Byte sink, NULL selects the built-in USART0 sink
+ * @retval Number of pulses sent
+ * @note 'E' 'V' 'R' version | tick_ns | count | entries | CRC16, little-endian.
+ *       Entries below the count snapshot are never rewritten by the ISR
+ *       (only ev1527_RawStart restarts the buffer), so no lock is held while sending.
+ * ------------------------------------------------------- */
+uint16_t ev1527_RawDump(ev1527_RawPut_T _Put)
+{
+  if(_Put == NULL)
+  {
+#if EV_Raw_UART
+    _Put = ev1527_rawPutUART;
+#else
+    return 0;                                              /**< No sink available */
+#endif
+  };
+
+  uint16_t _Count = ev1527_RawCount();
+  uint16_t _CRC = 0xFFFF;
+  const uint8_t _Header[8] =
+  {
+    'E', 'V', 'R', EV_Raw_Version,
+    (uint8_t)EV_Raw_TickNs, (uint8_t)(EV_Raw_TickNs >> 8),
+    (uint8_t)_Count, (uint8_t)(_Count >> 8)
+  };
+
+  for(uint8_t _i = 0; _i < sizeof(_Header); _i++) _CRC = ev1527_rawSend(_Put, _CRC, _Header[_i]);
+  for(uint16_t _i = 0; _i < _Count; _i++)
+  {
+    uint16_t _Entry = rawBuffer[_i];
+    _CRC = ev1527_rawSend(_Put, _CRC, (uint8_t)_Entry);
+    _CRC = ev1527_rawSend(_Put, _CRC, (uint8_t)(_Entry >> 8));
+  };
+  _Put((uint8_t)_CRC);                                     /**< CRC is not part of itself */
+  _Put((uint8_t)(_CRC >> 8));
+  return _Count;
+};
+#endif
+
+
+#if EV_Stats_Enable
+/* ============================================================================
+ *                         DECODER STATISTICS
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Take a consistent snapshot of the decoder statistics
+ * @param _Stats: Destination
+ * @param _Clear: true to reset all counters after the copy
+ * @retval None
+ * ------------------------------------------------------- */
+void ev1527_GetStats(ev1527_Stats_T *_Stats, bool _Clear)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    *_Stats = ev1527_Stats;                                /**< Capture ISR may update any field */
+    if(_Clear) ev1527_Stats = (ev1527_Stats_T){0};
+  };
+};
+#endif
+
+
+#if EV_Bench_Enable
+/* ============================================================================
+ *                         CYCLE BENCHMARK
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Read the cycle measurement of one decoder path
+ * @param _Path: EV_Path_xxx
+ * @param _Bench: Destination
+ * @param _Clear: true to restart the measurement of this path after the copy
+ * @retval None
+ * ------------------------------------------------------- */
+void ev1527_GetBench(uint8_t _Path, ev1527_Bench_T *_Bench, bool _Clear)
+{
+  if(_Path >= EV_Path_Count) return;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    *_Bench = benchPaths[_Path];                           /**< Decoder may record from the capture ISR */
+    if(_Clear) benchPaths[_Path] = (ev1527_Bench_T){0};
+  };
+};
+#endif
+
 
 /* ============================================================================
  *                         INTERRUPT SERVICE ROUTINE
  * ============================================================================ */
 
+#if EV_Capture_Mode == EV_Capture_INT0
+#if EV_Stamp_Enable && (EV_LowPower_Mode == EV_LowPower_Off)
+static volatile uint8_t timerOverflow = 0;                 /**< Timer1 wraps since the previous edge (saturates at 254) */
+#endif
+
 /* -------------------------------------------------------
  * @brief External interrupt service routine for INT0 (RF data pin)
  * @retval None
- * @note This ISR implements a state machine to decode EV1527 protocol:
- *       1. Detects first edge and initializes measurement
- *       2. Alternates between measuring HIGH and LOW pulses
- *       3. Validates preamble pattern
- *       4. Decodes 24 data bits using pulse width comparison
- *       5. Automatically disables decoder after successful reception
+ * @note Software timestamping backend:
+ *       1. Reads TCNT1 (elapsed ticks since previous edge) and resets it
+ *          TOV1 set → timer wrapped → duration saturated to EV_Tick_Overflow
+ *       2. Detects first edge and initializes measurement
+ *       3. Alternates between rising and falling edge detection
+ *       4. Passes each pulse (duration + level) to ev1527_pulseHandler()
  * @note State machine variables:
  *       - firstTime_Trigger: true=waiting for first edge, false=measuring
- *       - measureDone: true=both HIGH and LOW captured, ready to decode
- *       - preambleDetec: true=valid preamble found, ready for data bits
- *       - _Index: current bit position (0-23)
+ *       - EICRA.ISC00: 1=rising edge expected (LOW pulse running),
+ *                      0=falling edge expected (HIGH pulse running)
  * ------------------------------------------------------- */
 ISR(INT0_vect) 
 {
-  /* State machine static variables (persist between ISR calls) */
-  static bool firstTime_Trigger = true;                    /**< Flag: true=first edge not yet detected, initialize on first edge */
-  static bool measureDone = false;                         /**< Flag: true=complete HIGH+LOW pulse measured, ready to process */
-  static bool preambleDetec = false;                       /**< Flag: true=valid preamble detected, start decoding data bits */
-  static uint8_t _Index = 0;                               /**< Current bit index (0-23) in 24-bit data frame */
-  static uint16_t Signal_High_Tick = 0;                    /**< Duration of HIGH pulse in timer ticks */
-  static uint16_t Signal_Low_Tick = 0;                     /**< Duration of LOW pulse in timer ticks */
-  
+  ev1527_Channel_T *_ch = &ev1527_Channels[0];             /**< Single channel backend */
+  uint16_t _Tick = EV_Timer_Value;                         /**< Capture pulse duration from timer */
+  EV_Timer_Reset;                                          /**< Reset timer to start measuring next pulse */
+
+  /* Timer1 wrapped since the previous edge - pulse longer than 16 bits */
+#if EV_Stamp_Enable && (EV_LowPower_Mode == EV_LowPower_Off)
+  uint8_t _Overflow = timerOverflow;                       /**< Wraps counted by TIMER1_OVF_vect */
+  if(bitCheck(TIFR1, TOV1))                                /**< Pending - INT0 has priority over the overflow vector */
+  {
+    TIFR1 = (1 << TOV1);
+    if(_Tick < 0x8000) _Overflow++;                        /**< Wrapped before the read */
+  };
+  timerOverflow = 0;
+  if(_Overflow)
+  {
+    _Tick = EV_Tick_Overflow;                              /**< Saturate duration */
+    ev1527_idleAdd(_ch, _Overflow - 1);                    /**< Further silent periods for the decoder clock */
+  };
+#else
+  if(bitCheck(TIFR1, TOV1))                                /**< Overflow flag polled, no interrupt needed */
+  {
+    TIFR1 = (1 << TOV1);                                   /**< Clear TOV1 (write one) */
+    _Tick = EV_Tick_Overflow;                              /**< Saturate duration */
+  };
+#endif
+
   /* ===== FIRST EDGE DETECTION (INITIALIZATION) ===== */
-  if(firstTime_Trigger)                                    /**< First edge detected - initialize decoder */
-  {
-    /* Reset all measurement variables */
-    Signal_High_Tick = 0x00;                               /**< Clear HIGH pulse measurement */
-    Signal_Low_Tick  = 0x00;                               /**< Clear LOW pulse measurement */
-    _Index = 0;                                            /**< Reset bit index to start */
-    ev1527_Data.rawValue = 0x0;                            /**< Clear decoded data buffer */
-    preambleDetec = false;                                 /**< Clear preamble detection flag */
-    
-    /* Start timer and configure for next edge */
-    EV_Timer_Reset;                                        /**< Reset Timer1 to 0 to start timing */
-    firstTime_Trigger = false;                             /**< Mark initialization complete */
+  if(_ch->firstTime_Trigger)                               /**< First edge detected - start timing */
+  {
+    _ch->firstTime_Trigger = false;                        /**< Mark initialization complete */
     bitClear(EICRA, ISC00);                                /**< Set INT0 to falling edge (ISC01=1, ISC00=0) */
+#if EV_LowPower_Mode != EV_LowPower_Off
+    EV_Timer_Start;                                        /**< Ungate Timer1 - counting from 0 */
+#endif
   }
   /* ===== SUBSEQUENT EDGES (MEASUREMENT) ===== */
+  else if(bitCheck(EICRA, ISC00))                          /**< Check ISC00 bit: 1=rising edge just detected */
+  {
+    /* Rising edge detected - LOW pulse measurement complete */
+    bitClear(EICRA, ISC00);                                /**< Switch to falling edge detection for next pulse */
+    ev1527_pulseCapture(_ch, _Tick, EV_Level_Low);         /**< Process HIGH+LOW pair */
+  }
+  else                                                     /**< ISC00=0: falling edge just detected */
+  {
+    /* Falling edge detected - HIGH pulse measurement complete */
+    bitSet(EICRA, ISC00);                                  /**< Switch to rising edge detection for next pulse */
+    ev1527_pulseCapture(_ch, _Tick, EV_Level_High);        /**< Store HIGH pulse */
+  };
+};
+
+#if EV_Stamp_Enable && (EV_LowPower_Mode == EV_LowPower_Off)
+/* -------------------------------------------------------
+ * @brief Timer1 overflow interrupt service routine (EV_Capture_INT0, EV_Stamp_Enable)
+ * @retval None
+ * @note Counts the silent timer periods between two edges for the decoder clock
+ * ------------------------------------------------------- */
+ISR(TIMER1_OVF_vect)
+{
+  if(timerOverflow < 254) timerOverflow++;                 /**< One pending wrap may still be added by INT0_vect */
+};
+#endif
+
+#if EV_LowPower_Mode != EV_LowPower_Off
+/* -------------------------------------------------------
+ * @brief Timer1 overflow interrupt service routine (EV_Capture_INT0, low-power)
+ * @retval None
+ * @note No edge for a full timer period (32.7ms at 0.5µs/tick):
+ *       1. Hand a saturated pulse to the decoder (drops any partial frame)
+ *       2. Gate Timer1 off and re-arm on the next rising edge
+ *       ev1527_Idle() can then use the deep sleep mode again
+ * ------------------------------------------------------- */
+ISR(TIMER1_OVF_vect)
+{
+  ev1527_Channel_T *_ch = &ev1527_Channels[0];
+  EV_Timer_Stop;                                           /**< Gate Timer1 clock off */
+  EV_Timer_Reset;
+
+  if(!_ch->firstTime_Trigger)
+  {
+    ev1527_pulseCapture(_ch, EV_Tick_Overflow, bitCheck(EICRA, ISC00) ? EV_Level_Low : EV_Level_High);  /**< Line stuck at current level */
+    _ch->firstTime_Trigger = true;                         /**< Next edge starts a new measurement */
+    bitSet(EICRA, ISC00);                                  /**< Wait for a rising edge */
+  };
+};
+
+#if EV_LowPower_Mode == EV_LowPower_PowerSave
+/* -------------------------------------------------------
+ * @brief Pin change interrupt on PD2 (PCINT18) - wake-up from power-save
+ * @retval None
+ * @note INT0 edge detection needs the I/O clock, which is stopped in power-save.
+ *       The asynchronous pin change logic wakes the MCU, then INT0 takes over.
+ * ------------------------------------------------------- */
+ISR(PCINT2_vect)
+{
+  bitClear(PCICR, PCIE2);                                  /**< One-shot: disable pin change wake-up */
+  bitClear(PCMSK2, PCINT18);
+};
+#endif
+#endif
+
+#elif EV_Capture_Mode == EV_Capture_ICP1
+static volatile uint8_t timerOverflow = 0;                 /**< Timer1 overflows since previous capture (saturates at EV_Overflow_Max) */
+
+#if EV_Stamp_Enable
+#define EV_Overflow_Max  254                               /**< Silent periods are counted for the timestamp */
+#else
+#define EV_Overflow_Max  2                                 /**< Only "more than one" matters */
+#endif
+
+/* -------------------------------------------------------
+ * @brief Timer1 overflow interrupt service routine (EV_Capture_ICP1)
+ * @retval None
+ * @note Extends the free-running 16-bit timebase: two or more wraps
+ *       between captures mean the pulse exceeds the 16-bit range
+ * ------------------------------------------------------- */
+ISR(TIMER1_OVF_vect)
+{
+  if(timerOverflow < EV_Overflow_Max) timerOverflow++;
+};
+
+/* -------------------------------------------------------
+ * @brief Timer1 Input Capture interrupt service routine (ICP1 pin)
+ * @retval None
+ * @note Hardware timestamping backend:
+ *       1. ICR1 holds the Timer1 value latched by hardware on the edge
+ *       2. Pulse duration = ICR1 - previous ICR1 (Timer1 is free-running,
+ *          unsigned 16-bit subtraction handles a single counter wrap,
+ *          longer pulses are saturated to EV_Tick_Overflow)
+ *       3. Toggles ICES1 for the opposite edge and clears ICF1
+ *       4. Passes each pulse (duration + level) to ev1527_pulseHandler()
+ * @note Interrupt latency no longer affects the measured pulse width,
+ *       and the timer is never written (no dropped ticks)
+ * ------------------------------------------------------- */
+ISR(TIMER1_CAPT_vect)
+{
+  static uint16_t lastCapture = 0;                         /**< Timestamp of previous edge */
+  ev1527_Channel_T *_ch = &ev1527_Channels[0];             /**< Single channel backend */
+  uint16_t _Stamp = ICR1;                                  /**< Hardware-latched timestamp of this edge */
+  uint16_t _Tick  = _Stamp - lastCapture;                  /**< Pulse duration in timer ticks */
+  uint8_t _Overflow = timerOverflow;
+
+  /* Overflow pending but not yet serviced (capture vector has priority):
+     it belongs to this interval only if it happened before the capture */
+  if(bitCheck(TIFR1, TOV1) && (_Stamp < 0x8000))
+  {
+    TIFR1 = (1 << TOV1);                                   /**< Consume the flag here instead of TIMER1_OVF_vect */
+    _Overflow++;
+  };
+
+  if((_Overflow > 1) || ((_Overflow == 1) && (_Stamp >= lastCapture)))
+  {
+    _Tick = EV_Tick_Overflow;                              /**< More than 16 bits elapsed - saturate */
+#if EV_Stamp_Enable
+    ev1527_idleAdd(_ch, _Overflow - 1);                    /**< Further silent periods for the decoder clock */
+#endif
+  };
+  timerOverflow = 0;
+  lastCapture = _Stamp;
+
+  /* Toggle capture edge - ICF1 must be cleared after changing ICES1 */
+  uint8_t _Level = bitCheck(TCCR1B, ICES1) ? EV_Level_Low : EV_Level_High;  /**< Rising edge ends a LOW pulse */
+  bitToggle(TCCR1B, ICES1);                                /**< Capture the opposite edge next */
+  TIFR1 = (1 << ICF1);                                     /**< Clear ICF1 (write one) */
+
+  /* ===== FIRST EDGE DETECTION (INITIALIZATION) ===== */
+  if(_ch->firstTime_Trigger)                               /**< First edge only provides the start timestamp */
+  {
+    _ch->firstTime_Trigger = false;                        /**< Mark initialization complete */
+  }
   else
   {
-    /* Check which edge triggered the interrupt */
-    if(bitCheck(EICRA, ISC00))                             /**< Check ISC00 bit: 1=rising edge just detected */
-    {
-      /* Rising edge detected - LOW pulse measurement complete */
-      Signal_Low_Tick = EV_Timer_Value;                    /**< Capture LOW pulse duration from timer */
-      measureDone = true;                                  /**< Set flag: complete HIGH+LOW pulse captured */
-      bitClear(EICRA, ISC00);                              /**< Switch to falling edge detection for next pulse */
-    }
-    else                                                   /**< ISC00=0: falling edge just detected */
-    {
-      /* Falling edge detected - HIGH pulse measurement complete */
-      Signal_High_Tick = EV_Timer_Value;                   /**< Capture HIGH pulse duration from timer */
-      EV_Timer_Reset;                                      /**< Reset timer to start measuring LOW pulse */
-      bitSet(EICRA, ISC00);                                /**< Switch to rising edge detection for next pulse */
-    }
+    ev1527_pulseCapture(_ch, _Tick, _Level);               /**< Process pulse */
   };
-  
-  /* ===== PULSE PROCESSING (DECODE BITS) ===== */
-  if(measureDone)                                          /**< Check if complete HIGH+LOW pulse captured */
+};
+
+#elif EV_Capture_Mode == EV_Capture_Shared
+/* -------------------------------------------------------
+ * @brief Timer1 overflow interrupt service routine (EV_Capture_Shared)
+ * @retval None
+ * @note Extends the shared free-running timebase for all channels
+ * ------------------------------------------------------- */
+ISR(TIMER1_OVF_vect)
+{
+  timerEpoch++;
+};
+
+/* -------------------------------------------------------
+ * @brief Dispatch one edge interrupt to every channel bound to the source
+ * @param _src: Interrupt source (EV_Source_xxx, compile-time constant)
+ * @param _port: PINx register value read in the ISR
+ * @retval None
+ * @note Inlined with a constant source, unbound channels are removed by the compiler.
+ *       A pin change group with several channels runs the decoder of each of them:
+ *       channels whose pin did not change are rejected by the level check.
+ * ------------------------------------------------------- */
+static inline void ev1527_sourceCapture(uint8_t _src, uint8_t _port)
+{
+  if(EV_Channel0_Source == _src) ev1527_edgeCapture(&ev1527_Channels[0], bitCheck(_port, EV_Source_Bit(_src, EV_Channel0_Pin)));
+#if EV_Channel_Count > 1
+  if(EV_Channel1_Source == _src) ev1527_edgeCapture(&ev1527_Channels[1], bitCheck(_port, EV_Source_Bit(_src, EV_Channel1_Pin)));
+#endif
+#if EV_Channel_Count > 2
+  if(EV_Channel2_Source == _src) ev1527_edgeCapture(&ev1527_Channels[2], bitCheck(_port, EV_Source_Bit(_src, EV_Channel2_Pin)));
+#endif
+#if EV_Channel_Count > 3
+  if(EV_Channel3_Source == _src) ev1527_edgeCapture(&ev1527_Channels[3], bitCheck(_port, EV_Source_Bit(_src, EV_Channel3_Pin)));
+#endif
+};
+
+#if EV_Source_Mask(EV_Source_INT0)
+ISR(INT0_vect)   { ev1527_sourceCapture(EV_Source_INT0, PIND); };    /**< PD2, any change */
+#endif
+#if EV_Source_Mask(EV_Source_INT1)
+ISR(INT1_vect)   { ev1527_sourceCapture(EV_Source_INT1, PIND); };    /**< PD3, any change */
+#endif
+#if EV_Source_Mask(EV_Source_PCINT0)
+ISR(PCINT0_vect) { ev1527_sourceCapture(EV_Source_PCINT0, PINB); };  /**< PORTB pin change */
+#endif
+#if EV_Source_Mask(EV_Source_PCINT1)
+ISR(PCINT1_vect) { ev1527_sourceCapture(EV_Source_PCINT1, PINC); };  /**< PORTC pin change */
+#endif
+#if EV_Source_Mask(EV_Source_PCINT2)
+ISR(PCINT2_vect) { ev1527_sourceCapture(EV_Source_PCINT2, PIND); };  /**< PORTD pin change */
+#endif
+
+#elif EV_Capture_Mode == EV_Capture_Software
+/* -------------------------------------------------------
+ * @brief Software capture backend: hand one measured pulse to the decoder
+ * @param _Channel: Channel index (0 to EV_Channel_Count-1)
+ * @param _Ticks: Pulse duration in ticks of the configured timebase
+ *        (EV_usToTicks), EV_Tick_Overflow for pulses beyond the 16-bit range
+ * @param _Level: EV_Level_High or EV_Level_Low (level of the pulse that ended)
+ * @retval None
+ * @note No interrupt, timer or port register is used by the decoder: the
+ *       state machine can be driven from recorded or synthetic traces on a
+ *       host build, from ev1527_RawDump() data or from another capture source
+ * @note Ignored before ev1527_Init() and after ev1527_deInit()
+ *       (EV_Reception_Single stops after the first frame as usual)
+ * ------------------------------------------------------- */
+void ev1527_Feed(uint8_t _Channel, uint16_t _Ticks, uint8_t _Level)
+{
+  if(!feedEnabled || (_Channel >= EV_Channel_Count)) return;
+  ev1527_pulseCapture(&ev1527_Channels[_Channel], _Ticks, _Level ? EV_Level_High : EV_Level_Low);
+};
+
+#else
+    #error "EV_Capture_Mode must be EV_Capture_INT0, EV_Capture_ICP1, EV_Capture_Shared or EV_Capture_Software"
+#endif
+
+
+#if EV_Storm_Enable
+/* -------------------------------------------------------
+ * @brief Timer1 compare A interrupt service routine (noise storm back-off)
+ * @retval None
+ * @note Runs every EV_Storm_Sample_Ticks while the edge interrupt is masked:
+ *       1. Back-off: count down stormHold, the pin is not read
+ *       2. Sampling: EV_Storm_Quiet LOW samples in a row re-arm the
+ *          edge interrupt for a new measurement, the decoder restarts clean
+ * ------------------------------------------------------- */
+ISR(TIMER1_COMPA_vect)
+{
+  OCR1A += EV_Storm_Sample_Ticks;                          /**< Next sample, Timer1 keeps running */
+  if(stormHold)
+  {
+    stormHold--;
+    return;
+  };
+
+#if EV_Capture_Mode == EV_Capture_INT0
+  if(bitCheck(PIND, 2))                                    /**< PD2 HIGH - not a preamble gap */
+#else
+  if(bitCheck(PINB, 0))                                    /**< PB0 HIGH - not a preamble gap */
+#endif
   {
-    /* Check if preamble already detected */
-    if(preambleDetec)                                      /**< Preamble found - decode data bits */
+    stormQuiet = 0;
+    return;
+  };
+  if(++stormQuiet < EV_Storm_Quiet) return;
+
+  /* ===== Steady LOW: re-arm the edge interrupt ===== */
+  ev1527_Channel_T *_ch = &ev1527_Channels[0];
+  bitClear(TIMSK1, OCIE1A);
+#if EV_Decode_Mode == EV_Decode_Deferred
+  _ch->pulseLost = true;                                   /**< Gap marker ahead of the next pulse */
+#else
+  ev1527_decoderReset(_ch);
+#endif
+#if EV_Glitch_Enable
+  _ch->glitchLevel = EV_Glitch_None;
+#endif
+  _ch->firstTime_Trigger = true;                           /**< Next edge (end of the LOW) starts a measurement */
+#if EV_Capture_Mode == EV_Capture_INT0
+  bitSet(EICRA, ISC00);                                    /**< Rising edge first */
+  bitSet(EICRA, ISC01);
+  EIFR = (1 << INTF0);                                     /**< Drop the edge latched while masked */
+  bitSet(EIMSK, INT0);
+#else
+  bitSet(TCCR1B, ICES1);                                   /**< Rising edge first */
+  TIFR1 = (1 << ICF1);                                     /**< Drop the capture latched while masked */
+  bitSet(TIMSK1, ICIE1);
+#endif
+};
+#endif
+
+
+#if EV_Tx_Enable
+#if (EV_Tx_Output == EV_Tx_OC2B) && (EV_Capture_Mode == EV_Capture_Shared)
+#if EV_Source_Count(EV_Source_INT1)
+    #error "EV_Tx_OC2B drives PD3, which is an INT1 receiver channel - select EV_Tx_OC2A"
+#endif
+#endif
+
+/* -------------------------------------------------------
+ * @brief Load the next compare period of the transmission
+ * @retval None
+ * @note The compare match that ends the period applies the next level in
+ *       hardware: the opposite level at the end of a half-pulse, the same
+ *       level inside a half-pulse split over several periods
+ * @note Periods are at most 256 ticks and never shorter than 128 ticks or 1T,
+ *       so OCR2A is always written long before TCNT2 reaches it
+ * ------------------------------------------------------- */
+static inline void ev1527_txLoad(void)
+{
+  uint16_t _Chunk = txLeft;
+  if(_Chunk > 512) _Chunk = 256;
+  else if(_Chunk > 256) _Chunk >>= 1;                      /**< Two periods of 129-256 ticks */
+  txLeft -= _Chunk;
+
+  OCR2A = (uint8_t)(_Chunk - 1);                           /**< CTC: period = OCR2A + 1 ticks */
+#if EV_Tx_Output == EV_Tx_OC2B
+  OCR2B = (uint8_t)(_Chunk - 1);                           /**< OC2B matches at TOP together with OC2A */
+#endif
+  bool _Clear = !(txHalf & 0x01);                          /**< Even half-pulses are HIGH: clear at their end */
+  if(txLeft) _Clear = !_Clear;                             /**< Inside the half-pulse: keep the level */
+  TCCR2A = (1 << WGM21) | (_Clear ? EV_Tx_Com_Clear : EV_Tx_Com_Set);
+};
+
+/* -------------------------------------------------------
+ * @brief Advance to the next half-pulse
+ * @retval false when the transmission is complete
+ * @note Sequence per frame: sync HIGH 1T, sync LOW EV_Tx_Sync_T×T, then per bit
+ *       HIGH/LOW 1T/3T ('0') or 3T/1T ('1'). The sync HIGH after the last
+ *       frame closes its final LOW for the receiver and ends the transmission.
+ * ------------------------------------------------------- */
+static inline bool ev1527_txNext(void)
+{
+  uint8_t _Half = txHalf + 1;
+  if(_Half > EV_Tx_LastHalf)                               /**< Frame complete - next sync HIGH */
+  {
+    _Half = 0;
+    txShift = txFrame;
+    txLeft = EV_Tx_Tick_T;
+  }
+  else if(_Half == 1)                                      /**< Sync LOW: only if another frame follows */
+  {
+    if(txRepeats == 0) return false;
+    txRepeats--;
+    txLeft = EV_Tx_Tick_Sync;
+  }
+  else
+  {
+    bool _Bit = txShift & 0x01;
+    if(_Half & 0x01)                                       /**< LOW half: bit done */
     {
-      /* Validate pulse timing is within acceptable range */
-      if(EV_pulseIsValid(Signal_Low_Tick, Signal_High_Tick))  /**< Check if pulse duration is valid (450-8500 ticks) */
-      {
-        /* Decode bit and store in result */
-        bitChange(ev1527_Data.rawValue, _Index, EV_bitCheck(Signal_Low_Tick, Signal_High_Tick));  /**< Decode bit: HIGH≥1.5×LOW → '1', else '0' */
-        _Index++;                                          /**< Move to next bit position */
-        
-        /* Check if all 24 bits received */
-        if(_Index > EV_maxIndexData)                       /**< Check if index exceeded 23 (all 24 bits received) */
-        {
-          ev1527_Data.Bits.Detect = true;                  /**< Set detection flag - valid code received */
-          firstTime_Trigger = true;                        /**< Reset state machine for next frame */
-          preambleDetec = false;                           /**< Clear preamble flag */
-          ev1527_deInit();                                 /**< Disable decoder (prevent re-triggering until manually re-enabled) */
-        };
-      }
-      else                                                 /**< Invalid pulse timing */
-      {
-        /* Reset decoder on invalid pulse */
-        firstTime_Trigger = true;                          /**< Reset state machine */
-        preambleDetec = false;                             /**< Clear preamble flag */
-        bitSet(EICRA, ISC00);                              /**< Set to rising edge detection */
-      };
+      txLeft = _Bit ? EV_Tx_Tick_T : EV_Tx_Tick_3T;
+      txShift >>= 1;
     }
-    /* Preamble not yet detected - check for preamble pattern */
-    else
+    else txLeft = _Bit ? EV_Tx_Tick_3T : EV_Tx_Tick_T;
+  };
+  txHalf = _Half;
+  return true;
+};
+
+/* -------------------------------------------------------
+ * @brief Timer2 compare A interrupt service routine (transmitter)
+ * @retval None
+ * @note Entered right after a compare match has set the pin; loads the
+ *       following period, so only the interrupt latency has to be shorter
+ *       than one period (at least 128 ticks) - the edges never jitter
+ * ------------------------------------------------------- */
+ISR(TIMER2_COMPA_vect)
+{
+  if(txLeft == 0)                                          /**< Half-pulse complete */
+  {
+    if(!ev1527_txNext())
     {
-      /* Check if pulse matches preamble timing (LOW 25-40× HIGH) */
-      if(EV_PrembleCheck(Signal_Low_Tick, Signal_High_Tick))  /**< Validate preamble pattern */
-      {   
-        preambleDetec = true;                              /**< Set preamble detection flag - ready to decode data */
-      }
-      else
-      {
-        /* Not a preamble - continue waiting */
-      };
+      TCCR2B = 0x00;                                       /**< Stop Timer2 */
+      bitClear(TIMSK2, OCIE2A);
+      TCCR2A = 0x00;                                       /**< Pin back to PORT (LOW), the last match already cleared it */
+      txBusy = false;
+      return;
     };
-    
-    /* Prepare for next pulse measurement */
-    EV_Timer_Reset;                                        /**< Reset timer for next pulse */
-    measureDone = false;                                   /**< Clear measurement complete flag */
   };
+  ev1527_txLoad();
 };
+#endif
 
 
 /* ============================================================================
@@ -194,16 +2353,72 @@ ISR(INT0_vect)
  * ============================================================================ */
 
 /* -------------------------------------------------------
- * @brief Initialize EV1527 decoder hardware (Timer1 and INT0)
+ * @brief Initialize EV1527 decoder hardware (Timer1 and INT0 / ICP1 / channel sources)
  * @retval None
  * @note Configuration:
- *       - Timer1: Normal mode, prescaler /8 (0.5µs resolution at 16MHz)
- *       - INT0: Rising edge trigger initially, enabled
+ *       - Timer1: Normal mode, prescaler EV_Timer_Prescaler (/8: 0.5µs resolution at 16MHz)
+ *       - EV_Capture_INT0: INT0 rising edge trigger initially, enabled
+ *       - EV_Capture_ICP1: Input Capture rising edge initially, optional
+ *         noise canceler, capture interrupt enabled, Timer1 free-running
+ *       - EV_Capture_Shared: INT0/INT1 on any change and pin change masks for
+ *         every bound channel, Timer1 free-running with overflow interrupt
+ *       - EV_Timer_App: Timer1 mode and prescaler are left as the application set them
  * @note Must call this before attempting to decode RF signals
  *       Global interrupts (sei()) must be enabled separately
  * ------------------------------------------------------- */
 void ev1527_Init(void)
 {
+#if EV_Store_Enable
+  if(!storeStarted) ev1527_storeBegin();                   /**< Select EEPROM half, records load lazily */
+#endif
+  for(uint8_t _n = 0; _n < EV_Channel_Count; _n++)
+  {
+    ev1527_Channel_T *_ch = &ev1527_Channels[_n];
+    ev1527_decoderReset(_ch);                              /**< Reset all measurement variables */
+#if EV_Decode_Mode == EV_Decode_Deferred
+    _ch->pulseTail = _ch->pulseHead;                       /**< Discard pulses left from a previous session */
+    _ch->pulseLost = false;
+#endif
+#if EV_Confirm_Enable && (EV_Reception_Mode == EV_Reception_Single)
+    _ch->confirmCount = 0;                                 /**< Timebase stopped while disabled - forget repeat history */
+#endif
+#if EV_Capture_Mode == EV_Capture_Shared
+    _ch->lastLevel = 0xFF;                                 /**< Accept whatever level the first edge reports */
+#endif
+#if EV_Glitch_Enable
+    _ch->glitchLevel = EV_Glitch_None;                     /**< No pulse held from a previous session */
+#endif
+#if EV_Soft_Enable
+    ev1527_softClear(_ch);                                 /**< Votes of a previous session are stale */
+#endif
+#if EV_Stamp_Enable
+    _ch->idleWraps = 0;
+    _ch->stampGap = true;                                  /**< Time not counted while disabled - next frame is a new press */
+#endif
+    _ch->Channel = _n;
+    _ch->firstTime_Trigger = true;                         /**< Next edge starts a new measurement */
+  };
+
+#if EV_Storm_Enable
+  bitClear(TIMSK1, OCIE1A);                                /**< Leave a storm back-off from a previous session */
+  stormTicks = 0;
+  stormEdges = 0;
+#endif
+
+#if EV_Debug_Enable
+  GPIO_Config_OUTPUT(DDRC, EV_Debug_Bit);                  /**< PC0 debug pulse output */
+  bitClear(PORTC, EV_Debug_Bit);
+#endif
+
+#if EV_Capture_Mode == EV_Capture_Software
+  feedEnabled = true;                                      /**< No hardware to configure - accept ev1527_Feed() */
+#if EV_Bench_Enable
+  TCCR1A = 0x00;                                           /**< Normal mode */
+  TCCR1B = (1 << CS10);                                    /**< Timer1 free-running at /1: cycle clock of the benchmark */
+#endif
+#else
+
+#if EV_Capture_Mode == EV_Capture_INT0
   /* ===== Configure INT0 External Interrupt ===== */
   GPIO_Config_INPUT(DDRD, 2);
   /* Set INT0 to trigger on rising edge (ISC01:ISC00 = 11) */
@@ -212,18 +2427,95 @@ void ev1527_Init(void)
   
   /* Enable INT0 interrupt */
   bitSet(EIMSK, INT0);                                     /**< Enable INT0 in External Interrupt Mask Register */
+  TIFR1 = (1 << TOV1);                                     /**< Clear stale overflow flag (polled by the ISR) */
+#if EV_LowPower_Mode != EV_LowPower_Off
+  bitSet(TIMSK1, TOIE1);                                   /**< Overflow = line idle timeout, gates Timer1 off */
+#elif EV_Stamp_Enable
+  timerOverflow = 0;
+  bitSet(TIMSK1, TOIE1);                                   /**< Overflow counts silent periods for the timestamp */
+#endif
+#endif
   
+#if EV_Timer_Owner == EV_Timer_Own
   /* ===== Configure Timer1 ===== */
   /* Set Timer1 to Normal mode (WGM13:WGM10 = 0000) */
   bitClear(TCCR1A, WGM10);                                 /**< WGM10=0: Normal mode (part 1) */
   bitClear(TCCR1A, WGM11);                                 /**< WGM11=0: Normal mode (part 2) */
   bitClear(TCCR1B, WGM12);                                 /**< WGM12=0: Normal mode (part 3) */
+#endif
   
-  /* Set Timer1 prescaler to /8 (CS12:CS10 = 010) */
+#if EV_Capture_Mode == EV_Capture_ICP1
+  /* ===== Configure Timer1 Input Capture Unit ===== */
+  GPIO_Config_INPUT(DDRB, 0);                              /**< ICP1 pin (PB0 on ATmega328P) as input */
+  bitClear(TCCR1B, WGM13);                                 /**< WGM13=0: Normal mode (part 4) - ICR1 used as capture register */
+  bitSet(TCCR1B, ICES1);                                   /**< ICES1=1: Capture on rising edge first */
+#if EV_ICP_NoiseCanceler
+  bitSet(TCCR1B, ICNC1);                                   /**< ICNC1=1: Enable 4-sample input noise canceler */
+#else
+  bitClear(TCCR1B, ICNC1);                                 /**< ICNC1=0: Noise canceler disabled */
+#endif
+  TIFR1 = (1 << ICF1) | (1 << TOV1);                       /**< Clear any pending capture / overflow flag */
+  bitSet(TIMSK1, ICIE1);                                   /**< Enable Timer1 Input Capture interrupt */
+  bitSet(TIMSK1, TOIE1);                                   /**< Enable Timer1 overflow interrupt (timebase extension) */
+#endif
+
+#if EV_Capture_Mode == EV_Capture_Shared
+  /* ===== Configure channel sources (any-change edges) ===== */
+#if EV_Timer_Owner == EV_Timer_Own
+  bitClear(TCCR1B, WGM13);                                 /**< WGM13=0: Normal mode (part 4) */
+#endif
+#if EV_Source_Mask(EV_Source_INT0)
+  GPIO_Config_INPUT(DDRD, 2);
+  bitSet(EICRA, ISC00);                                    /**< ISC01:ISC00 = 01: any logical change */
+  bitClear(EICRA, ISC01);
+  bitSet(EIMSK, INT0);
+#endif
+#if EV_Source_Mask(EV_Source_INT1)
+  GPIO_Config_INPUT(DDRD, 3);
+  bitSet(EICRA, ISC10);                                    /**< ISC11:ISC10 = 01: any logical change */
+  bitClear(EICRA, ISC11);
+  bitSet(EIMSK, INT1);
+#endif
+#if EV_Source_Mask(EV_Source_PCINT0)
+  DDRB &= ~EV_Source_Mask(EV_Source_PCINT0);               /**< Bound PORTB pins as inputs */
+  PCMSK0 |= EV_Source_Mask(EV_Source_PCINT0);
+  bitSet(PCICR, PCIE0);
+#endif
+#if EV_Source_Mask(EV_Source_PCINT1)
+  DDRC &= ~EV_Source_Mask(EV_Source_PCINT1);               /**< Bound PORTC pins as inputs */
+  PCMSK1 |= EV_Source_Mask(EV_Source_PCINT1);
+  bitSet(PCICR, PCIE1);
+#endif
+#if EV_Source_Mask(EV_Source_PCINT2)
+  DDRD &= ~EV_Source_Mask(EV_Source_PCINT2);               /**< Bound PORTD pins as inputs */
+  PCMSK2 |= EV_Source_Mask(EV_Source_PCINT2);
+  bitSet(PCICR, PCIE2);
+#endif
+  TIFR1 = (1 << TOV1);                                     /**< Clear stale overflow flag */
+  bitSet(TIMSK1, TOIE1);                                   /**< Enable Timer1 overflow interrupt (timerEpoch) */
+#endif
+
+#if (EV_LowPower_Mode != EV_LowPower_Off) && (EV_Capture_Mode == EV_Capture_INT0)
+  /* Low-power: Timer1 stays gated off until the first edge */
+  EV_Timer_Stop;
+  EV_Timer_Reset;
+#elif EV_Timer_Owner == EV_Timer_App
+  /* Timer1 mode and prescaler are set by the application - left untouched */
+#else
+  /* Set Timer1 prescaler to EV_Timer_Prescaler (default /8, CS12:CS10 = 010) */
   /* At 16MHz: Timer frequency = 16MHz/8 = 2MHz → 0.5µs per tick */
-  bitClear(TCCR1B, CS10);                                  /**< CS10=0: Prescaler /8 (part 1) */
-  bitSet(TCCR1B, CS11);                                    /**< CS11=1: Prescaler /8 (part 2) */
-  bitClear(TCCR1B, CS12);                                  /**< CS12=0: Prescaler /8 (part 3) */
+  bitChange(TCCR1B, CS10, bitCheck(EV_Timer_CS, 0));       /**< CS10: Prescaler select (part 1) */
+  bitChange(TCCR1B, CS11, bitCheck(EV_Timer_CS, 1));       /**< CS11: Prescaler select (part 2) */
+  bitChange(TCCR1B, CS12, bitCheck(EV_Timer_CS, 2));       /**< CS12: Prescaler select (part 3) */
+#endif
+
+#if EV_Bench_Exact
+  /* ===== Configure Timer0: cycle counter of the benchmark ===== */
+  TCCR0A = 0x00;                                           /**< Normal mode, OC0A/OC0B disconnected */
+  TCCR0B = (1 << CS00);                                    /**< Free-running at /1 */
+  TIMSK0 = 0x00;                                           /**< No Timer0 interrupt */
+#endif
+#endif
 };
 
 
@@ -235,14 +2527,19 @@ void ev1527_Init(void)
  * @brief Disable EV1527 decoder and release hardware resources
  * @retval None
  * @note Deinitialization sequence:
- *       1. Disable INT0 external interrupt
+ *       1. Disable INT0 external interrupt / Timer1 capture interrupt / channel sources
  *       2. Stop Timer1 (set prescaler to 0 = no clock source)
  *       3. Set Timer1 to normal mode (clear all WGM bits)
+ *       Steps 2 and 3 are skipped with EV_Timer_App (Timer1 keeps running for the application)
  * @note Use this to save power when RF reception not needed
  *       or after successful code reception to prevent re-triggering
  * ------------------------------------------------------- */
 void ev1527_deInit(void)
 {
+#if EV_Capture_Mode == EV_Capture_Software
+  feedEnabled = false;                                     /**< Ignore fed pulses until ev1527_Init() */
+#else
+#if EV_Capture_Mode == EV_Capture_INT0
   /* ===== Disable INT0 External Interrupt ===== */
   /* Clear INT0 edge detection configuration */
   bitClear(EICRA, ISC00);                                  /**< ISC00=0: Disable edge detection (part 1) */
@@ -250,7 +2547,45 @@ void ev1527_deInit(void)
   
   /* Disable INT0 interrupt */
   bitClear(EIMSK, INT0);                                   /**< Disable INT0 in External Interrupt Mask Register */
+#if (EV_LowPower_Mode != EV_LowPower_Off) || EV_Stamp_Enable
+  bitClear(TIMSK1, TOIE1);                                 /**< Disable idle timeout / silent period interrupt */
+#endif
+#elif EV_Capture_Mode == EV_Capture_ICP1
+  /* ===== Disable Timer1 Input Capture ===== */
+  bitClear(TIMSK1, ICIE1);                                 /**< Disable Timer1 Input Capture interrupt */
+  bitClear(TIMSK1, TOIE1);                                 /**< Disable Timer1 overflow interrupt */
+  bitClear(TCCR1B, ICES1);                                 /**< Clear capture edge select */
+  bitClear(TCCR1B, ICNC1);                                 /**< Disable noise canceler */
+#elif EV_Capture_Mode == EV_Capture_Shared
+  /* ===== Disable channel sources ===== */
+#if EV_Source_Mask(EV_Source_INT0)
+  bitClear(EIMSK, INT0);
+  bitClear(EICRA, ISC00);
+#endif
+#if EV_Source_Mask(EV_Source_INT1)
+  bitClear(EIMSK, INT1);
+  bitClear(EICRA, ISC10);
+#endif
+#if EV_Source_Mask(EV_Source_PCINT0)
+  PCMSK0 &= ~EV_Source_Mask(EV_Source_PCINT0);
+  bitClear(PCICR, PCIE0);
+#endif
+#if EV_Source_Mask(EV_Source_PCINT1)
+  PCMSK1 &= ~EV_Source_Mask(EV_Source_PCINT1);
+  bitClear(PCICR, PCIE1);
+#endif
+#if EV_Source_Mask(EV_Source_PCINT2)
+  PCMSK2 &= ~EV_Source_Mask(EV_Source_PCINT2);
+  bitClear(PCICR, PCIE2);
+#endif
+  bitClear(TIMSK1, TOIE1);                                 /**< Disable Timer1 overflow interrupt */
+#endif
   
+#if EV_Storm_Enable
+  bitClear(TIMSK1, OCIE1A);                                /**< Stop the storm back-off timer */
+#endif
+  
+#if EV_Timer_Owner == EV_Timer_Own
   /* ===== Disable Timer1 ===== */
   /* Clear Timer1 mode configuration (set to Normal mode - all WGM bits = 0) */
   bitClear(TCCR1A, WGM10);                                 /**< WGM10=0: Clear mode bit */
@@ -261,4 +2596,283 @@ void ev1527_deInit(void)
   bitClear(TCCR1B, CS10);                                  /**< CS10=0: Stop timer (part 1) */
   bitClear(TCCR1B, CS11);                                  /**< CS11=0: Stop timer (part 2) */
   bitClear(TCCR1B, CS12);                                  /**< CS12=0: Stop timer (part 3) - redundant but ensures complete stop */
+#endif
+#endif
+
+#if EV_Decode_Mode == EV_Decode_Deferred
+  for(uint8_t _n = 0; _n < EV_Channel_Count; _n++)
+  {
+    ev1527_Channels[_n].pulseTail = ev1527_Channels[_n].pulseHead;  /**< Drop pending pulses - capture is stopped */
+  };
+#endif
+};
+
+
+/* ============================================================================
+ *                       LOW-POWER IDLE
+ * ============================================================================ */
+
+#if EV_LowPower_Mode != EV_LowPower_Off
+/* -------------------------------------------------------
+ * @brief Sleep until the next interrupt (RF edge or application interrupt)
+ * @retval None
+ * @note EV_LowPower_Idle: SLEEP_MODE_IDLE - Timer1 and INT0 keep running
+ *       EV_LowPower_PowerSave: SLEEP_MODE_PWR_SAVE while the decoder is armed
+ *       and Timer1 is gated off (no frame in progress), PD2 pin change wakes
+ *       the MCU; SLEEP_MODE_IDLE while a frame is being measured
+ * @note Returns immediately if deferred pulses are waiting for ev1527_Process()
+ *       or a frame was published since the previous call, so
+ *       "if(!ev1527_Take(&c)) ev1527_Idle();" never sleeps on a pending frame
+ * @note The sleep decision and sleep_cpu() are atomic (sei; sleep sequence),
+ *       a wake-up interrupt cannot be lost between the check and sleep
+ * ------------------------------------------------------- */
+void ev1527_Idle(void)
+{
+  cli();                                                   /**< Check state and sleep atomically */
+
+  if(frameEvent)                                           /**< Frame published after the caller's last check */
+  {
+    frameEvent = false;
+    sei();
+    return;
+  };
+
+#if EV_Decode_Mode == EV_Decode_Deferred
+  for(uint8_t _n = 0; _n < EV_Channel_Count; _n++)
+  {
+    if(ev1527_Channels[_n].pulseTail != ev1527_Channels[_n].pulseHead)  /**< Pulses pending - decode first */
+    {
+      sei();
+      return;
+    };
+  };
+#endif
+
+#if (EV_LowPower_Mode == EV_LowPower_PowerSave) && (EV_Capture_Mode == EV_Capture_INT0)
+#if EV_Tx_Enable
+  if(ev1527_Channels[0].firstTime_Trigger && !txBusy)      /**< Timer1 gated off, Timer2 idle - safe to stop the I/O clock */
+#else
+  if(ev1527_Channels[0].firstTime_Trigger)                 /**< Timer1 gated off - safe to stop the I/O clock */
+#endif
+  {
+    PCIFR = (1 << PCIF2);                                  /**< Clear stale pin change flag */
+    bitSet(PCMSK2, PCINT18);                               /**< PD2 (INT0 pin) wakes the MCU */
+    bitSet(PCICR, PCIE2);
+    set_sleep_mode(SLEEP_MODE_PWR_SAVE);
+  }
+  else
+  {
+    set_sleep_mode(SLEEP_MODE_IDLE);                       /**< Frame in progress - Timer1 must keep counting */
+  };
+#else
+  set_sleep_mode(SLEEP_MODE_IDLE);
+#endif
+
+  sleep_enable();
+  sei();                                                   /**< Next instruction (sleep) executes before any ISR */
+  sleep_cpu();
+  sleep_disable();
+};
+#endif
+
+
+/* ============================================================================
+ *                       FRAME QUEUE ACCESS
+ * ============================================================================ */
+
+#if EV_Queue_Enable
+/* -------------------------------------------------------
+ * @brief Number of decoded frames waiting in the output queue
+ * @retval Frame count (0 to EV_Queue_Size-1)
+ * ------------------------------------------------------- */
+uint8_t ev1527_Available(void)
+{
+  return (frameHead - frameTail) & EV_Queue_Mask;
+};
+
+/* -------------------------------------------------------
+ * @brief Take the oldest decoded frame from the output queue
+ * @param _Code: Destination for the frame (Detect bit is set)
+ * @retval true if a frame was copied, false if the queue is empty
+ * @note Lock-free: the slot is released only after it has been copied
+ * ------------------------------------------------------- */
+bool ev1527_Read(ev1527_T *_Code)
+{
+  uint8_t _Tail = frameTail;
+  if(_Tail == frameHead) return false;                     /**< Queue empty */
+
+  _Code->rawValue = frameQueue[_Tail].rawValue;            /**< Copy entry before releasing the slot */
+  _Code->rawTag = frameQueue[_Tail].rawTag;
+  frameTail = (_Tail + 1) & EV_Queue_Mask;
+  return true;
+};
+
+#if EV_Stamp_Enable
+/* -------------------------------------------------------
+ * @brief Take the oldest decoded frame with its timestamp and repeat count
+ * @param _Record: Destination for the record
+ * @retval true if a record was copied, false if the queue is empty
+ * @note Lock-free like ev1527_Read()
+ * ------------------------------------------------------- */
+bool ev1527_ReadRecord(ev1527_Record_T *_Record)
+{
+  uint8_t _Tail = frameTail;
+  if(_Tail == frameHead) return false;                     /**< Queue empty */
+
+  _Record->Code.rawValue = frameQueue[_Tail].rawValue;     /**< Copy entry before releasing the slot */
+  _Record->Code.rawTag = frameQueue[_Tail].rawTag;
+  _Record->Time = frameStamp[_Tail].Time;
+  _Record->Repeat = frameStamp[_Tail].Repeat;
+  _Record->Gesture = frameStamp[_Tail].Gesture;
+  frameTail = (_Tail + 1) & EV_Queue_Mask;
+  return true;
+};
+#endif
+
+/* -------------------------------------------------------
+ * @brief Number of frames lost because the output queue was full
+ * @retval Overflow count (saturates at 255)
+ * ------------------------------------------------------- */
+uint8_t ev1527_Overflow(void)
+{
+  return frameOverflow;
+};
+#endif
+
+/* -------------------------------------------------------
+ * @brief Atomically take the latest frame and clear its Detect flag
+ * @param _Code: Destination for the frame
+ * @retval true if a new frame was pending
+ * @note The decoder cannot publish between the copy and the clear
+ * ------------------------------------------------------- */
+bool ev1527_Take(ev1527_T *_Code)
+{
+  bool _Ready;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    _Code->rawValue = ev1527_Data.rawValue;
+    _Code->rawTag = ev1527_Data.rawTag;
+    _Ready = ev1527_Data.Bits.Detect;
+    ev1527_Data.Bits.Detect = false;
+  };
+  return _Ready;
+};
+
+#if EV_Callback_Enable
+/* -------------------------------------------------------
+ * @brief Register the frame handler
+ * @param _Handler: Function to call for every frame, NULL to unregister
+ * @retval None
+ * @note The pointer is written atomically, the decoder never sees half of it
+ * ------------------------------------------------------- */
+void ev1527_OnFrame(ev1527_Handler_T _Handler)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    frameHandler = _Handler;
+  };
+};
+#endif
+
+
+/* ============================================================================
+ *                       DEFERRED DECODER TASK
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Run the decoder state machine on all captured pulses
+ * @retval None
+ * @note EV_Decode_Deferred: drains the edge ring buffer of every channel
+ *       filled by the capture ISR and decodes each pulse in main-loop context
+ *       EV_Decode_ISR: nothing to do (decoding already done in the ISR)
+ * @note EV_Store_Enable: replays EV_Store_LoadBatch EEPROM records per call
+ *       and saves a remote enrolled by ev1527_LearnNext()
+ * @note Call regularly from the main loop; each buffer holds
+ *       EV_pulseBuffer_Size pulses (one data bit = 2 pulses)
+ * ------------------------------------------------------- */
+void ev1527_Process(void)
+{
+#if EV_Decode_Mode == EV_Decode_Deferred
+  for(uint8_t _n = 0; _n < EV_Channel_Count; _n++)
+  {
+    ev1527_Channel_T *_ch = &ev1527_Channels[_n];
+    while(_ch->pulseTail != _ch->pulseHead)                /**< Pulses pending */
+    {
+      uint8_t _Tail = _ch->pulseTail;
+      uint16_t _Entry = _ch->pulseBuffer[_Tail];           /**< Read entry before releasing the slot */
+      _ch->pulseTail = (_Tail + 1) & EV_pulseBuffer_Mask;
+
+      if(_Entry == EV_Pulse_Gap)                           /**< Pulses were dropped - resynchronize */
+      {
+        ev1527_decoderReset(_ch);
+      }
+      else
+      {
+        uint16_t _Tick = _Entry & 0xFFFE;                  /**< Unpack duration and level */
+        if(_Tick == (EV_Tick_Overflow & 0xFFFE)) _Tick = EV_Tick_Overflow;  /**< Packing cleared bit 0 of the saturation value */
+        ev1527_pulseDecode(_ch, _Tick, _Entry & 0x0001);
+      };
+    };
+  };
+#endif
+
+#if EV_Callback_Enable && (EV_Callback_Mode == EV_Callback_Deferred)
+  if(frameHandler != NULL)                                 /**< Only written by ev1527_OnFrame() in this context */
+  {
+    ev1527_T _Code;
+    while(ev1527_Read(&_Code)) frameHandler(_Code);        /**< Main-loop context */
+  };
+#endif
+
+#if EV_Store_Enable
+  ev1527_storeTask();                                      /**< Lazy load and pairing persistence */
+#endif
+};
+
+
+#if EV_Tx_Enable
+/* ============================================================================
+ *                       RF TRANSMITTER
+ * ============================================================================ */
+
+/* -------------------------------------------------------
+ * @brief Start sending a code in the background
+ * @param _Code: Code to send (data bits only, tag bits are ignored)
+ * @param _Repeats: Number of frames (1-255)
+ * @retval true if started, false if busy or _Repeats is 0
+ * @note The first edge is forced (FOC), all later edges come from compare
+ *       matches of Timer2 in CTC mode
+ * ------------------------------------------------------- */
+bool ev1527_Transmit(ev1527_T _Code, uint8_t _Repeats)
+{
+  if(txBusy || (_Repeats == 0)) return false;
+
+  txFrame = _Code.rawValue & EV_Frame_Mask;
+  txShift = txFrame;
+  txRepeats = _Repeats;
+  txHalf = 0;                                              /**< Sync HIGH */
+  txLeft = EV_Tx_Tick_T;
+  txBusy = true;
+
+  bitClear(EV_Tx_PORT, EV_Tx_Bit);                         /**< Idle level once the compare output is released */
+  bitSet(EV_Tx_DDR, EV_Tx_Bit);
+  TCCR2B = 0x00;                                           /**< Timer2 stopped while it is set up */
+  TCNT2 = 0x00;
+  TCCR2A = (1 << WGM21) | EV_Tx_Com_Set;
+  TCCR2B = EV_Tx_Force;                                    /**< Pin HIGH now: sync pulse starts */
+  ev1527_txLoad();                                         /**< First period and the edge that ends it */
+  TIFR2 = (1 << OCF2A);
+  bitSet(TIMSK2, OCIE2A);
+  TCCR2B = EV_Tx_CS;                                       /**< Start counting: CTC mode (WGM22 = 0) */
+  return true;
+};
+
+/* -------------------------------------------------------
+ * @brief Check for a running transmission
+ * @retval true until the last edge is out
+ * ------------------------------------------------------- */
+bool ev1527_TxBusy(void)
+{
+  return txBusy;
 };
+#endif
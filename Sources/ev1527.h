@@ -12,10 +12,31 @@
  * @note     FUNCTION SUMMARY:
  *           - ev1527_Init   : Initialize Timer1 and external interrupt for RF signal capture
  *           - ev1527_deInit : Disable Timer1 and external interrupt to stop decoding
+ *           - ev1527_Process: Decode queued pulses in main loop (EV_Decode_Deferred)
+ *           - ev1527_Available : Number of decoded frames in the output queue
+ *           - ev1527_Read      : Take the oldest decoded frame from the queue
+ *           - ev1527_Overflow  : Frames lost on a full queue
+ *           - ev1527_Take      : Atomic snapshot-and-clear of ev1527_Data
+ *           - ev1527_OnFrame   : Register a frame handler (EV_Callback_Enable)
+ *           - ev1527_Idle      : Sleep between RF edges (EV_LowPower_Mode)
+ *           - ev1527_Learn / ev1527_Forget / ev1527_Known : Address whitelist (EV_Whitelist_Enable)
+ *           - ev1527_StoreReady : EEPROM backed whitelist loaded (EV_Store_Enable)
+ *           - ev1527_RawStart / ev1527_RawDump : Raw pulse capture and binary dump (EV_Raw_Enable)
+ *           - ev1527_GetStats  : Decoder statistics snapshot (EV_Stats_Enable)
+ *           - ev1527_GetBench  : Per-path decoder cycle histogram (EV_Bench_Enable)
+ *           - ev1527_Transmit  : Send a code in the background on Timer2 (EV_Tx_Enable)
+ * 
+ * @note     Capture backends (EV_Capture_Mode):
+ *           - EV_Capture_INT0 : INT0 edge interrupt, TCNT1 read and reset in software
+ *           - EV_Capture_ICP1 : Timer1 Input Capture, free-running hardware timestamps
+ *           - EV_Capture_Shared : Any-change INT0/INT1/PCINT edges on a shared free-running
+ *                                 Timer1, up to EV_Channel_Count receivers
+ *           - EV_Capture_Software : Pulses passed to ev1527_Feed(), no hardware access
  * 
  * @note     EV1527 Protocol Specifications:
  *           - Encoding: Manchester-like pulse width modulation
  *           - Data format: 24 bits total (20-bit address + 4-bit data/key)
+ *             (clones with 12-32 bits: EV_Data_Bits / EV_Key_Bits)
  *           - Bit encoding:
  *             * Logic '0': Short HIGH (1×T) + Long LOW (3×T)
  *             * Logic '1': Long HIGH (3×T) + Short LOW (1×T)
@@ -23,12 +44,14 @@
  *           - Base period (T): ~300-350µs typical
  *           - Frame structure: [Preamble][20-bit Address][4-bit Key][Sync]
  * 
- * @note     Timing Specifications:
+ * @note     Timing Specifications (µs, converted to ticks from F_CPU and EV_Timer_Prescaler):
  *           - Minimum pulse width: ~300µs (1×T)
  *           - Maximum pulse width: ~1200µs (4×T for preamble)
  *           - Preamble LOW: 25-40× longer than preamble HIGH
- *           - Valid pulse range: 450-8500 timer ticks
+ *           - Valid pulse range: 225-4250µs (450-8500 ticks at 16MHz, /8)
  *           - Bit decision: HIGH ≥ 1.5× LOW duration → '1', else → '0'
+ *             (integer compare 2×HIGH ≥ 3×LOW, ratio set by EV_bitRatio_Num/Den)
+ *           - EV_Adaptive_T: window narrowed to the T measured on the preamble and bits
  * 
  * @note     Hardware Requirements:
  *           - 433MHz/315MHz RF receiver module connected to external interrupt pin
@@ -70,6 +93,7 @@
 #define _ev1527_H_
 
 #include "aKaReZa.h"
+#include "ev1527_config.h"                /**< Project options and profile, read before the defaults below */
 
 
 /* ============================================================================
@@ -107,12 +131,99 @@
  */
 #define EV_Timer_Value TCNT1             /**< Current Timer1 count value (elapsed ticks) */
 
+/**
+ * @brief Timer1 prescaler (1, 8, 64, 256 or 1024)
+ * @note All timing thresholds below are given in µs and converted to ticks
+ *       at compile time from F_CPU and this prescaler
+ *       Default /8: 0.5µs per tick at 16MHz, 1µs per tick at 8MHz
+ */
+#ifndef EV_Timer_Prescaler
+    #define EV_Timer_Prescaler  8
+#endif
+
+#if   EV_Timer_Prescaler == 1
+    #define EV_Timer_CS  0x01            /**< CS12:CS10 = 001 */
+#elif EV_Timer_Prescaler == 8
+    #define EV_Timer_CS  0x02            /**< CS12:CS10 = 010 */
+#elif EV_Timer_Prescaler == 64
+    #define EV_Timer_CS  0x03            /**< CS12:CS10 = 011 */
+#elif EV_Timer_Prescaler == 256
+    #define EV_Timer_CS  0x04            /**< CS12:CS10 = 100 */
+#elif EV_Timer_Prescaler == 1024
+    #define EV_Timer_CS  0x05            /**< CS12:CS10 = 101 */
+#else
+    #error "EV_Timer_Prescaler must be 1, 8, 64, 256 or 1024"
+#endif
+
+/**
+ * @brief Gate Timer1 clock on/off (low-power mode)
+ * @note EV_Timer_Start assumes the clock is stopped (CS12:CS10 = 000)
+ */
+#define EV_Timer_Start TCCR1B |= EV_Timer_CS                                      /**< Connect prescaled clock */
+#define EV_Timer_Stop  TCCR1B &= ~((1 << CS12) | (1 << CS11) | (1 << CS10))      /**< No clock source */
+
+#ifndef F_CPU
+    #error "F_CPU must be defined for the EV1527 timing thresholds"
+#endif
+
+/**
+ * @brief Convert µs to Timer1 ticks at compile time
+ * @param _us: Duration in microseconds (constant)
+ * @retval Tick count (unsigned long long constant, usable in #if)
+ * @note Evaluated by the compiler/preprocessor only - never use with variables
+ */
+#define EV_usToTicks(_us)  (((_us) * (F_CPU / 1000ULL)) / (EV_Timer_Prescaler * 1000ULL))
+
 
 /* ============================================================================
  *                         PROTOCOL PARAMETERS
  * ============================================================================ */
 
-#define EV_maxIndexData  23              /**< Maximum bit index (0-23 for 24 bits total: 20 address + 4 key) */
+/**
+ * @brief Data bits per frame (12 to 32)
+ * @note 24 for the EV1527 itself. Clones send 12, 28 or 32 bits with the same
+ *       bit encoding and preamble.
+ */
+#ifndef EV_Data_Bits
+    #define EV_Data_Bits  24
+#endif
+
+/**
+ * @brief Key bits at the end of the frame (1 to 8), the bits before them are the address
+ */
+#ifndef EV_Key_Bits
+    #define EV_Key_Bits  4
+#endif
+
+#if (EV_Data_Bits < 12) || (EV_Data_Bits > 32)
+    #error "EV_Data_Bits must be between 12 and 32"
+#endif
+#if (EV_Key_Bits < 1) || (EV_Key_Bits > 8)
+    #error "EV_Key_Bits must be between 1 and 8"
+#endif
+
+#define EV_Address_Bits  (EV_Data_Bits - EV_Key_Bits)  /**< Address bits at the start of the frame */
+#define EV_maxIndexData  (EV_Data_Bits - 1)            /**< Maximum bit index (0-23 for 24 bits total: 20 address + 4 key) */
+
+/**
+ * @brief Decoder frame storage, sized to EV_Data_Bits
+ * @note Up to 16 bits the decoder shifts, votes and filters in 16-bit registers
+ */
+#if EV_Data_Bits <= 16
+    typedef uint16_t ev1527_frame_T;
+#else
+    typedef uint32_t ev1527_frame_T;
+#endif
+
+#define EV_Frame_Top      ((ev1527_frame_T)1 << EV_maxIndexData)                            /**< Accumulator entry bit (first bit ends in bit 0) */
+#define EV_Frame_Mask     ((ev1527_frame_T)(0xFFFFFFFFUL >> (32 - EV_Data_Bits)))           /**< All data bits */
+#define EV_Address_Mask   ((ev1527_frame_T)(0xFFFFFFFFUL >> (32 - EV_Address_Bits)))        /**< Address bits */
+#define EV_Key_Mask       ((uint8_t)(0xFF >> (8 - EV_Key_Bits)))                            /**< Key bits after >> EV_Address_Bits */
+
+#define EV_Level_Low     0               /**< Pulse level tag: LOW pulse (ended by a rising edge) */
+#define EV_Level_High    1               /**< Pulse level tag: HIGH pulse (ended by a falling edge) */
+
+#define EV_Tick_Overflow 0xFFFF          /**< Saturated pulse duration: longer than the 16-bit Timer1 range */
 
 
 /* ============================================================================
@@ -120,18 +231,93 @@
  * ============================================================================ */
 
 /**
- * @brief Minimum valid pulse duration in timer ticks
+ * @brief Minimum valid HIGH+LOW pulse duration in µs
  * @note Pulses shorter than this are considered noise
- *       Typical: ~150µs at 16MHz with prescaler 8 → 450 ticks
+ *       225µs → 450 ticks at 16MHz with prescaler 8
  */
-#define HPL_min          450             /**< Minimum combined HIGH+LOW pulse duration (noise filter) */
+#ifndef EV_Pulse_min_us
+    #define EV_Pulse_min_us  225
+#endif
 
 /**
- * @brief Maximum valid pulse duration in timer ticks
+ * @brief Maximum valid HIGH+LOW pulse duration in µs
  * @note Pulses longer than this are invalid or timeout
- *       Typical: ~3ms at 16MHz with prescaler 8 → 8500 ticks
+ *       4250µs → 8500 ticks at 16MHz with prescaler 8
+ */
+#ifndef EV_Pulse_Max_us
+    #define EV_Pulse_Max_us  4250
+#endif
+
+/**
+ * @brief Longest preamble LOW pulse that must be measurable (µs)
+ * @note 31×T for the slowest supported transmitter (T ≈ 1ms)
+ *       Checked at compile time against the 16-bit Timer1 range
+ */
+#ifndef EV_Preamble_Max_us
+    #define EV_Preamble_Max_us  32000
+#endif
+
+#define HPL_min_Ticks    EV_usToTicks(EV_Pulse_min_us)  /**< Preprocessor form of HPL_min */
+#define HPL_Max_Ticks    EV_usToTicks(EV_Pulse_Max_us)  /**< Preprocessor form of HPL_Max */
+
+#define HPL_min          ((uint16_t)HPL_min_Ticks)      /**< Minimum combined HIGH+LOW pulse duration in ticks (noise filter) */
+#define HPL_Max          ((uint16_t)HPL_Max_Ticks)      /**< Maximum combined HIGH+LOW pulse duration in ticks (timeout threshold) */
+
+#if EV_usToTicks(EV_Preamble_Max_us) > 0xFFFF
+    #error "EV_Preamble_Max_us does not fit in 16-bit Timer1 at this F_CPU - select a larger EV_Timer_Prescaler"
+#endif
+
+#if HPL_min_Ticks < 8
+    #error "EV_Pulse_min_us is below 8 timer ticks - select a smaller EV_Timer_Prescaler"
+#endif
+
+
+/**
+ * @brief Adaptive base-period (T) estimation
+ * @note 1: T is measured from each preamble (HIGH+LOW = 32×T) and refined by a
+ *          running average over the bits of the frame. It narrows the bit
+ *          validity window for that frame:
+ *          - First EV_Adaptive_Learn bits: fixed HPL_min / HPL_Max window
+ *          - Then also EV_Adaptive_MinT×T < HIGH+LOW < EV_Adaptive_MaxT×T
+ *          The bit decision stays the EV_bitCheck ratio. Rejects glitches that
+ *          still fit the wide fixed window
+ *       0: fixed HPL_min / HPL_Max window and EV_bitCheck ratio (default)
+ */
+#ifndef EV_Adaptive_T
+    #define EV_Adaptive_T  0
+#endif
+
+#ifndef EV_Adaptive_MinT
+    #define EV_Adaptive_MinT  2          /**< Lower bit bound in multiples of T (nominal bit = 4T) */
+#endif
+#ifndef EV_Adaptive_MaxT
+    #define EV_Adaptive_MaxT  6          /**< Upper bit bound in multiples of T */
+#endif
+#ifndef EV_Adaptive_Learn
+    #define EV_Adaptive_Learn  4         /**< Bits checked against the fixed window only while T settles */
+#endif
+
+/**
+ * @brief Accepted range of the estimated base period T in µs
+ * @note Preambles giving T outside this range are ignored.
+ *       Defaults follow the fixed window: 4×T within EV_Pulse_min_us..EV_Pulse_Max_us
  */
-#define HPL_Max          8500            /**< Maximum combined HIGH+LOW pulse duration (timeout threshold) */
+#ifndef EV_T_min_us
+    #define EV_T_min_us  (EV_Pulse_min_us / 4)
+#endif
+#ifndef EV_T_Max_us
+    #define EV_T_Max_us  (EV_Pulse_Max_us / 4)
+#endif
+
+#define EV_Tick_T_min  ((uint16_t)EV_usToTicks(EV_T_min_us))  /**< Smallest accepted T in ticks */
+#define EV_Tick_T_Max  ((uint16_t)EV_usToTicks(EV_T_Max_us))  /**< Largest accepted T in ticks */
+
+#if EV_Adaptive_T && ((EV_Adaptive_MaxT * EV_usToTicks(EV_T_Max_us)) > 0xFFFF)
+    #error "EV_Adaptive_MaxT × EV_T_Max_us must fit in 16 timer bits"
+#endif
+#if EV_Adaptive_T && ((EV_Adaptive_Learn < 1) || (EV_Adaptive_Learn > EV_Data_Bits))
+    #error "EV_Adaptive_Learn must be between 1 and EV_Data_Bits"
+#endif
 
 
 /* ============================================================================
@@ -144,9 +330,10 @@
  * @param _tickHigh: HIGH pulse duration in timer ticks
  * @retval true if total pulse duration is valid, false otherwise
  * @note Filters out noise and invalid pulses
- *       Valid range: HPL_min (450) to HPL_Max (8500) ticks
+ *       Valid range: HPL_min (225µs) to HPL_Max (4250µs), in ticks
+ * @note Each pulse is limited to HPL_Max first, so the 16-bit sum cannot wrap
  */
-#define EV_pulseIsValid(_tickLow, _tickHigh)  (((_tickLow + _tickHigh) > HPL_min) && ((_tickLow + _tickHigh) < HPL_Max))
+#define EV_pulseIsValid(_tickLow, _tickHigh)  (((_tickLow) < HPL_Max) && ((_tickHigh) < HPL_Max) && (((_tickLow) + (_tickHigh)) > HPL_min) && (((_tickLow) + (_tickHigh)) < HPL_Max))
 
 /**
  * @brief Check if pulse pattern matches EV1527 preamble
@@ -156,23 +343,151 @@
  * @note Preamble timing: LOW pulse is 25-40× longer than HIGH pulse
  *       Example: LOW=10000µs, HIGH=320µs → ratio=31.25 → valid preamble
  *       This marks the start of a valid EV1527 data frame
+ * @note 16-bit safe without widening:
+ *       - HIGH > 0xFFFF/25: 25×HIGH exceeds any 16-bit LOW → never a preamble
+ *       - HIGH > 0xFFFF/40: 40×HIGH exceeds any 16-bit LOW → upper bound always met
+ *       so both products are only evaluated when they fit in 16 bits
+ */
+#define EV_PrembleCheck(_tickLow, _tickHigh)  (((_tickHigh) <= (0xFFFFU / 25U)) && \
+                                               ((_tickLow) >= (25U * (_tickHigh))) && \
+                                               (((_tickHigh) > (0xFFFFU / 40U)) || ((_tickLow) <= (40U * (_tickHigh)))))
+
+/**
+ * @brief Bit decision ratio (HIGH/LOW) as an integer fraction
+ * @note A bit is decoded as '1' when HIGH × EV_bitRatio_Den ≥ LOW × EV_bitRatio_Num
+ *       Default 3/2 reproduces the original 1.5× threshold without floating point
+ *       Override before including this header (or with -D) to tune the threshold
+ */
+#ifndef EV_bitRatio_Num
+    #define EV_bitRatio_Num  3           /**< Ratio numerator (applied to LOW duration) */
+#endif
+#ifndef EV_bitRatio_Den
+    #define EV_bitRatio_Den  2           /**< Ratio denominator (applied to HIGH duration) */
+#endif
+
+/**
+ * @brief Integer type used for the bit decision products
+ * @note EV_bitCheck is only evaluated after EV_pulseIsValid, so each pulse is below HPL_Max.
+ *       If both products fit in 16 bits the comparison stays on 16-bit registers,
+ *       otherwise it is widened to 32 bits. Selected at compile time - no runtime cost.
  */
-#define EV_PrembleCheck(_tickLow, _tickHigh)  ((_tickLow >= 25*_tickHigh) && (_tickLow <= 40*_tickHigh))
+#if ((EV_bitRatio_Num * HPL_Max_Ticks) <= 0xFFFF) && ((EV_bitRatio_Den * HPL_Max_Ticks) <= 0xFFFF)
+    typedef uint16_t ev1527_ratio_T;
+#else
+    typedef uint32_t ev1527_ratio_T;
+#endif
 
 /**
  * @brief Decode bit value from pulse width comparison
  * @param _tickLow: LOW pulse duration in timer ticks
  * @param _tickHigh: HIGH pulse duration in timer ticks
- * @retval 1 if HIGH duration ≥ 1.5× LOW duration (logic '1'), else 0 (logic '0')
+ * @retval 1 if HIGH duration ≥ (Num/Den)× LOW duration (logic '1'), else 0 (logic '0')
  * @note EV1527 bit encoding:
  *       - Logic '0': Short HIGH (1×T) + Long LOW (3×T) → HIGH/LOW ratio ≈ 0.33
  *       - Logic '1': Long HIGH (3×T) + Short LOW (1×T) → HIGH/LOW ratio ≈ 3.0
- *       - Threshold: 1.5× provides robust discrimination
+ *       - Threshold: 1.5× (3/2) provides robust discrimination
+ * @note Integer only: evaluated as Den×HIGH ≥ Num×LOW (no soft-float call in the ISR)
  * @note Example:
- *       - Bit '0': HIGH=300µs, LOW=900µs → 300 < 1.5×900 → returns 0
- *       - Bit '1': HIGH=900µs, LOW=300µs → 900 ≥ 1.5×300 → returns 1
+ *       - Bit '0': HIGH=300µs, LOW=900µs → 2×300 < 3×900 → returns 0
+ *       - Bit '1': HIGH=900µs, LOW=300µs → 2×900 ≥ 3×300 → returns 1
+ */
+#define EV_bitCheck(_tickLow, _tickHigh)      ((((ev1527_ratio_T)EV_bitRatio_Den * (_tickHigh)) >= ((ev1527_ratio_T)EV_bitRatio_Num * (_tickLow))) ? 1 : 0)
+
+
+/* ============================================================================
+ *                         PROTOCOL TABLE
+ * ============================================================================ */
+
+#define EV_Proto_EV1527  0               /**< Built-in EV1527 decoder (always enabled) */
+#define EV_Proto_PT2262  1               /**< PT2262 / SC5262 tri-state, 12 symbols = 24 pulse pairs */
+#define EV_Proto_HT12E   2               /**< Holtek HT12E, 8 address + 4 data bits */
+#define EV_Proto_User    3               /**< Application defined entry (EV_Protocol_User) */
+
+#define EV_ProtoFlag_Inverted  0x01      /**< Pairs are LOW then HIGH (sync and bits start with LOW) */
+#define EV_ProtoFlag_TriState  0x02      /**< Bit pairs '10' are invalid (PT2262 symbols 0, 1, F) */
+
+/**
+ * @brief Enable additional fixed-code OOK protocols next to EV1527
+ * @note Every enabled protocol runs its own state machine on the same pulse
+ *       stream; the first one completing a frame publishes it (tag in
+ *       ev1527_T.Bits.Protocol) and restarts all others.
+ * @note PT2262 uses the EV1527 waveform (sync 1T+31T, bits 1T/3T). Its frames
+ *       are reported as PT2262 when every symbol pair is valid tri-state,
+ *       otherwise the EV1527 decoder reports them.
+ * @note Disabled protocols are not compiled (no table entry, no state, no ISR cycles)
+ */
+#ifndef EV_Protocol_PT2262
+    #define EV_Protocol_PT2262  0
+#endif
+#ifndef EV_Protocol_HT12E
+    #define EV_Protocol_HT12E  0
+#endif
+
+/**
+ * @brief Accepted base period range of the table protocols (µs)
+ * @note HT12E: T = 1/3 data bit; the 36×T pilot must fit in 16 timer bits
+ */
+#ifndef EV_PT2262_T_min_us
+    #define EV_PT2262_T_min_us  EV_T_min_us
+#endif
+#ifndef EV_PT2262_T_Max_us
+    #define EV_PT2262_T_Max_us  EV_T_Max_us
+#endif
+#ifndef EV_HT12E_T_min_us
+    #define EV_HT12E_T_min_us  150
+#endif
+#ifndef EV_HT12E_T_Max_us
+    #define EV_HT12E_T_Max_us  800
+#endif
+
+/**
+ * @brief Protocol descriptor, all durations in multiples of the base period T
+ * @note T is estimated from the sync pair of every frame, the bit window is
+ *       50%-150% of (bitShort + bitLong)×T, a bit is '1' when its first pulse
+ *       is longer than half of that window
+ */
+typedef struct
+{
+    uint8_t Protocol;                    /**< EV_Proto_xxx tag copied into decoded frames */
+    uint8_t Flags;                       /**< EV_ProtoFlag_xxx */
+    uint8_t syncFirst;                   /**< Sync first pulse (HIGH, LOW if inverted) */
+    uint8_t syncSecond;                  /**< Sync second pulse */
+    uint8_t bitUnits;                    /**< bitShort + bitLong: one bit pair in T */
+    uint8_t bitCount;                    /**< Data bits per frame (up to EV_Data_Bits), last EV_Key_Bits bits become Keys */
+    uint16_t syncRecip;                  /**< 65536 / (syncFirst + syncSecond): T from the sync sum */
+    uint16_t tickT_min;                  /**< Smallest accepted T in ticks */
+    uint16_t tickT_Max;                  /**< Largest accepted T in ticks */
+} ev1527_Protocol_T;
+
+/**
+ * @brief Build a protocol descriptor (compile-time constants only)
+ * @note Example: EV_Protocol_Def(EV_Proto_User, 0, 1, 10, 1, 2, 24, 500, 800)
+ */
+#define EV_Protocol_Def(_proto, _flags, _syncFirst, _syncSecond, _bitShort, _bitLong, _bitCount, _Tmin_us, _Tmax_us) \
+    { (_proto), (_flags), (_syncFirst), (_syncSecond), (uint8_t)((_bitShort) + (_bitLong)), (_bitCount), \
+      (uint16_t)(65536UL / ((_syncFirst) + (_syncSecond))), (uint16_t)EV_usToTicks(_Tmin_us), (uint16_t)EV_usToTicks(_Tmax_us) }
+
+/**
+ * @brief Optional application protocol
+ * @note Define EV_Protocol_User as an EV_Protocol_Def(EV_Proto_User, ...) initializer
  */
-#define EV_bitCheck(_tickLow, _tickHigh)      ((_tickHigh >= 1.5*_tickLow) ? 1 : 0)
+#ifdef EV_Protocol_User
+    #define EV_Protocol_UserCount  1
+#else
+    #define EV_Protocol_UserCount  0
+#endif
+
+#define EV_Protocol_Count  (EV_Protocol_PT2262 + EV_Protocol_HT12E + EV_Protocol_UserCount)  /**< Table entries */
+
+#if EV_Protocol_PT2262 && ((3 * 4 * EV_usToTicks(EV_PT2262_T_Max_us) / 2) > 0xFFFF)
+    #error "EV_PT2262_T_Max_us × 6 must fit in 16 timer bits"
+#endif
+#if EV_Protocol_PT2262 && (EV_Data_Bits < 24)
+    #error "EV_Protocol_PT2262 needs EV_Data_Bits >= 24 (12 tri-state symbols)"
+#endif
+#if EV_Protocol_HT12E && ((37 * EV_usToTicks(EV_HT12E_T_Max_us)) > 0xFFFF)
+    #error "HT12E pilot (36×EV_HT12E_T_Max_us) does not fit in 16 timer bits - select a larger EV_Timer_Prescaler"
+#endif
 
 
 /* ============================================================================
@@ -181,54 +496,1278 @@
 
 /**
  * @brief EV1527 decoded data structure with bit-field access
- * @note Union allows access to 32-bit value or individual bit fields
- *       Total: 32 bits (24 data bits + 1 detect flag + 7 reserved)
+ * @note Two independent parts: the frame (rawValue, an ev1527_frame_T of 16 or
+ *       32 bits) and the tag byte (rawTag). 3 bytes up to 16 data bits,
+ *       5 bytes above
+ * @note Default layout: 24 data bits (20 address + 4 key) + 4 padding bits,
+ *       tag byte: 1 detect flag + 2 channel + 2 protocol + 3 quality
+ * @note EV_Data_Bits / EV_Key_Bits resize Address and Keys, the padding fills
+ *       the frame up to its ev1527_frame_T
  */
 typedef union 
 {
-    uint32_t rawValue;                   /**< Direct 32-bit access to entire decoded value */
+    struct
+    {
+        ev1527_frame_T rawValue;         /**< Direct access to the frame (all EV_Data_Bits data bits) */
+        uint8_t        rawTag;           /**< Direct access to the tag byte (Detect in bit 0) */
+    };
     
     struct
     {
-        uint32_t Address : 20;           /**< 20-bit unique transmitter address (0 to 1,048,575) */
-        uint32_t Keys    : 4;            /**< 4-bit key/button code (0 to 15) - identifies which button pressed */
-        uint32_t Detect  : 1;            /**< Detection flag: 1=valid code received, 0=no detection */
-        uint32_t Reserve : 7;            /**< Reserved bits for future use or alignment */
+        ev1527_frame_T Address : EV_Address_Bits;  /**< Unique transmitter address, 20 bits by default (0 to 1,048,575) */
+        ev1527_frame_T Keys    : EV_Key_Bits;      /**< Key/button code, 4 bits by default (0 to 15) - identifies which button pressed */
+        ev1527_frame_T         : (8 * sizeof(ev1527_frame_T)) - EV_Data_Bits;  /**< Padding: the tag starts in its own byte */
+        uint8_t Detect  : 1;             /**< Detection flag: 1=valid code received, 0=no detection */
+        uint8_t Channel : 2;             /**< Receiver channel the frame was decoded on (EV_Capture_Shared / Software) */
+        uint8_t Protocol: 2;             /**< Decoding protocol (EV_Proto_xxx) */
+        uint8_t Quality : 3;             /**< Signal quality of EV1527 frames, 1 (marginal) to 7 (clean); 0 = not rated (EV_Quality_Enable) */
     } Bits;                              /**< Bit-field structure for easy field access */
 } ev1527_T;
 
+/**
+ * @brief Fast field access on a frame copy
+ * @note Masks and byte picks instead of the bit-field extraction of
+ *       Bits.Address / Bits.Keys (no 32-bit shifts on AVR). Use them on a local
+ *       copy (ev1527_Read / ev1527_Take / handler argument), not on the volatile
+ *       ev1527_Data, whose every access re-reads the frame.
+ *       EV_Code_Frame: packed 24-bit frame, Address in bits 0-19, Keys in bits 20-23
+ * @note Other EV_Data_Bits / EV_Key_Bits: Frame and Address are ev1527_frame_T,
+ *       16-bit arithmetic for frames up to 16 bits
+ * @note Detect and Quality read the tag byte alone, whatever the frame length
+ */
+#if (EV_Data_Bits == 24) && (EV_Key_Bits == 4)
+#define EV_Code_Frame(_Code)    ((_Code).rawValue & 0x00FFFFFFUL)                  /**< 24 data bits */
+#define EV_Code_Address(_Code)  ((_Code).rawValue & 0x000FFFFFUL)                  /**< 20-bit transmitter address */
+#define EV_Code_Keys(_Code)     ((uint8_t)((uint8_t)((_Code).rawValue >> 16) >> 4))  /**< 4-bit key code (byte 2, high nibble) */
+#else
+#define EV_Code_Frame(_Code)    ((ev1527_frame_T)((_Code).rawValue & EV_Frame_Mask))  /**< EV_Data_Bits data bits */
+#define EV_Code_Address(_Code)  ((ev1527_frame_T)((_Code).rawValue & EV_Address_Mask))  /**< Transmitter address */
+#define EV_Code_Keys(_Code)     ((uint8_t)((_Code).rawValue >> EV_Address_Bits) & EV_Key_Mask)  /**< Key code */
+#endif
+#define EV_Code_Detect(_Code)   ((uint8_t)((_Code).rawTag & 0x01))                    /**< Detection flag (tag bit 0) */
+#define EV_Code_Quality(_Code)  ((uint8_t)((_Code).rawTag >> 5))                      /**< Signal quality (tag bits 5-7) */
+
 
 /* ============================================================================
- *                         FUNCTION PROTOTYPES
+ *                         CAPTURE BACKEND SELECTION
  * ============================================================================ */
 
+#define EV_Capture_INT0  0               /**< INT0 edge interrupt + software TCNT1 read/reset (default) */
+#define EV_Capture_ICP1  1               /**< Timer1 Input Capture Unit (ICR1), free-running timer */
+#define EV_Capture_Shared 2              /**< Any-change pin interrupts on a shared free-running Timer1 (multi-channel) */
+#define EV_Capture_Software 3            /**< Pulses fed by the application through ev1527_Feed(), no hardware used */
+
 /**
- * @brief Initialize EV1527 decoder hardware (Timer1 and external interrupt)
- * @retval None
- * @note Initialization sequence:
- *       1. Configure Timer1 for pulse width measurement
- *          - Set prescaler for µs resolution (typically /8 at 16MHz)
- *          - Enable normal counting mode (count up from 0)
- *       2. Configure external interrupt on RF data pin
- *          - Set to trigger on both edges (rising and falling)
- *          - Enable interrupt for pulse detection
- *       3. Initialize global variables for decoding state machine
- * @note Must be called before attempting to decode RF signals
- * @note Global interrupts (sei()) must be enabled for operation
+ * @brief Edge timestamping backend used by ev1527_Init()
+ * @note EV_Capture_INT0: RF data on INT0 (PD2), pulse width read from TCNT1 in the ISR
+ *       EV_Capture_ICP1: RF data on ICP1 (PB0), pulse width from hardware-latched ICR1 deltas
+ *                        - Cycle-exact widths, independent of interrupt latency
+ *                        - Timer1 is never reset, no ticks are dropped
+ *       EV_Capture_Shared: RF data on the pins bound by EV_ChannelN_Source, widths from
+ *                          TCNT1 deltas, Timer1 runs free and is never written
+ *       EV_Capture_Software: no ISR, timer or pin is used; pulse widths are passed to
+ *                            ev1527_Feed() in timebase ticks. Separates the decoder state
+ *                            machine from register access: host simulation / replay of
+ *                            recorded traces, or pulses measured by other application code
  */
-void ev1527_Init(void);
+#ifndef EV_Capture_Mode
+    #define EV_Capture_Mode  EV_Capture_INT0
+#endif
 
 /**
- * @brief Disable EV1527 decoder and release hardware resources
- * @retval None
- * @note Deinitialization sequence:
- *       1. Disable external interrupt (stop pulse detection)
- *       2. Stop Timer1 (disable clock source)
- *       3. Clear any pending interrupt flags
- *       4. Reset decoder state machine variables
- * @note Use this to save power when RF reception not needed
- *       or before reconfiguring hardware for other purposes
+ * @brief Timer1 input capture noise canceler (EV_Capture_ICP1 only)
+ * @note 1: ICNC1 set - edge accepted after 4 equal samples (adds 4 CPU clocks delay)
+ *       0: noise canceler disabled
  */
-void ev1527_deInit(void);
+#ifndef EV_ICP_NoiseCanceler
+    #define EV_ICP_NoiseCanceler  1
+#endif
+
+#define EV_Timer_Own  0                  /**< ev1527 configures, starts and stops Timer1 (default) */
+#define EV_Timer_App  1                  /**< Application owns Timer1, ev1527 only reads TCNT1 */
+
+/**
+ * @brief Timer1 ownership (EV_Capture_Shared only)
+ * @note EV_Timer_Own: ev1527_Init() sets normal mode and EV_Timer_Prescaler,
+ *                     ev1527_deInit() stops Timer1
+ *       EV_Timer_App: the application configures and runs Timer1 (servo PWM, ...),
+ *                     ev1527 never writes TCCR1A/B, TCNT1, OCR1x or ICR1 and only
+ *                     sets/clears TOIE1. The application must:
+ *                     - use the prescaler given in EV_Timer_Prescaler
+ *                     - use an up-counting mode with TOV1 at TOP: normal, or fast PWM
+ *                       with TOP in ICR1/OCR1A (not CTC, not phase correct)
+ *                     - set EV_Timer_Top to that TOP value
+ *                     - leave TIMER1_OVF_vect to ev1527 (timebase extension)
+ */
+#ifndef EV_Timer_Owner
+    #define EV_Timer_Owner  EV_Timer_Own
+#endif
+
+/**
+ * @brief Highest TCNT1 value before it wraps to 0 (EV_Timer_App)
+ * @note 0xFFFF in normal mode. Example: servo PWM in fast PWM mode 14 at /8,
+ *       ICR1 = 39999 (20ms at 16MHz) → EV_Timer_Top 39999
+ *       The longest pulse (EV_Preamble_Max_us) must be shorter than one timer period.
+ */
+#ifndef EV_Timer_Top
+    #define EV_Timer_Top  0xFFFF
+#endif
+
+#if (EV_Timer_Owner == EV_Timer_App) && (EV_Capture_Mode != EV_Capture_Shared)
+    #error "EV_Timer_App requires EV_Capture_Shared (the other backends write Timer1)"
+#endif
+#if (EV_Timer_Top != 0xFFFF) && (EV_Timer_Owner != EV_Timer_App)
+    #error "EV_Timer_Top is only used with EV_Timer_App"
+#endif
+#if (EV_Timer_Top > 0xFFFF) || (EV_usToTicks(EV_Preamble_Max_us) > EV_Timer_Top)
+    #error "EV_Preamble_Max_us does not fit in one period of the application timer - lower it or raise EV_Timer_Top"
+#endif
+
+/**
+ * @brief Ticks elapsed between two TCNT1 reads less than one timer period apart
+ * @note Plain 16-bit subtraction when the timer wraps at 0xFFFF,
+ *       otherwise the difference is taken modulo EV_Timer_Top + 1
+ */
+#if EV_Timer_Top == 0xFFFF
+    #define EV_Timer_Delta(_Now, _Then)  ((uint16_t)((_Now) - (_Then)))
+#else
+    #define EV_Timer_Delta(_Now, _Then)  ((uint16_t)(((_Now) >= (_Then)) ? ((_Now) - (_Then)) : ((_Now) - (_Then) + (EV_Timer_Top + 1))))
+#endif
+#define EV_Timer_Half  ((uint16_t)((EV_Timer_Top >> 1) + 1))   /**< Stamps below: read right after a wrap */
+#define EV_Timer_Period  ((uint32_t)EV_Timer_Top + 1)        /**< Ticks per Timer1 wrap */
+
+
+/* ============================================================================
+ *                         DECODER EXECUTION MODE
+ * ============================================================================ */
+
+#define EV_Decode_ISR       0            /**< Decode inside the capture ISR (default) */
+#define EV_Decode_Deferred  1            /**< ISR only queues pulses, ev1527_Process() decodes */
+
+/**
+ * @brief Where the preamble/bit state machine runs
+ * @note EV_Decode_ISR: complete decoding in interrupt context, ev1527_Process() is a no-op
+ *       EV_Decode_Deferred: capture ISR pushes a packed 16-bit pulse entry into a
+ *                           lock-free SPSC ring buffer and returns; the main loop
+ *                           must call ev1527_Process() to decode
+ */
+#ifndef EV_Decode_Mode
+    #define EV_Decode_Mode  EV_Decode_ISR
+#endif
+
+/**
+ * @brief Edge ring buffer size in pulses (EV_Decode_Deferred only)
+ * @note Must be a power of two, maximum 128. Each entry takes 2 bytes of SRAM.
+ *       A full frame is 50 pulses, size the buffer for the longest main-loop stall.
+ */
+#ifndef EV_pulseBuffer_Size
+    #define EV_pulseBuffer_Size  32
+#endif
+
+#if (EV_pulseBuffer_Size < 2) || (EV_pulseBuffer_Size > 128) || (EV_pulseBuffer_Size & (EV_pulseBuffer_Size - 1))
+    #error "EV_pulseBuffer_Size must be a power of two between 2 and 128"
+#endif
+
+#define EV_pulseBuffer_Mask  (EV_pulseBuffer_Size - 1)  /**< Index wrap mask */
+#define EV_Pulse_Gap         0x0000      /**< Ring entry marking dropped pulses (zero-length LOW) */
+
+
+/* ============================================================================
+ *                         RECEPTION MODE
+ * ============================================================================ */
+
+#define EV_Reception_Single      0       /**< Stop decoder after each frame, re-enable with ev1527_Init() (default) */
+#define EV_Reception_Continuous  1       /**< Keep decoding, state machine re-arms after each frame */
+
+/**
+ * @brief Decoder behaviour after a complete frame
+ * @note EV_Reception_Single: ev1527_deInit() is called after each frame
+ *       EV_Reception_Continuous: Timer1 and the capture interrupt stay active,
+ *                                repeat frames of a held button keep arriving
+ */
+#ifndef EV_Reception_Mode
+    #define EV_Reception_Mode  EV_Reception_Single
+#endif
+
+
+/* ============================================================================
+ *                         REPEAT CONFIRMATION FILTER
+ * ============================================================================ */
+
+/**
+ * @brief Enable repeat confirmation and duplicate suppression
+ * @note Sits between the bit decoder and the output (ev1527_Data / queue).
+ *       EV1527 transmitters send every code 4-20 times, a code is only reported
+ *       after EV_Confirm_Count identical frames in a row, and only once while
+ *       the button is held. Intended for EV_Reception_Continuous.
+ */
+#ifndef EV_Confirm_Enable
+    #define EV_Confirm_Enable  0
+#endif
+
+/**
+ * @brief Number of identical consecutive frames required before reporting (N)
+ */
+#ifndef EV_Confirm_Count
+    #define EV_Confirm_Count  2
+#endif
+
+/**
+ * @brief Hold-off window in milliseconds
+ * @note Copies of the same code closer than this belong to the same key press.
+ *       Default 200ms (one frame ≈ 40ms)
+ */
+#ifndef EV_HoldOff_ms
+    #define EV_HoldOff_ms  200
+#endif
+
+#define EV_HoldOff_Ticks  ((uint32_t)EV_usToTicks(EV_HoldOff_ms * 1000ULL))  /**< Hold-off window in ticks */
+
+#if EV_Confirm_Enable && ((EV_Confirm_Count < 1) || (EV_Confirm_Count > 255))
+    #error "EV_Confirm_Count must be between 1 and 255"
+#endif
+
+
+/* ============================================================================
+ *                         OUTPUT FRAME QUEUE
+ * ============================================================================ */
+
+/**
+ * @brief Enable the decoded frame FIFO (ev1527_Available / ev1527_Read)
+ * @note Lock-free single-producer/single-consumer queue between decoder and main loop.
+ *       ev1527_Data is still updated with the latest frame for polling code.
+ */
+#ifndef EV_Queue_Enable
+    #define EV_Queue_Enable  1
+#endif
+
+/**
+ * @brief Frame queue size (power of two, maximum 128)
+ * @note Holds EV_Queue_Size-1 frames, each entry takes 5 bytes of SRAM (3 with
+ *       EV_Data_Bits <= 16), plus 4 bytes of timing (ev1527_Stamp_T) with EV_Stamp_Enable
+ */
+#ifndef EV_Queue_Size
+    #define EV_Queue_Size  8
+#endif
+
+#if EV_Queue_Enable && ((EV_Queue_Size < 2) || (EV_Queue_Size > 128) || (EV_Queue_Size & (EV_Queue_Size - 1)))
+    #error "EV_Queue_Size must be a power of two between 2 and 128"
+#endif
+
+#define EV_Queue_Mask  (EV_Queue_Size - 1)  /**< Index wrap mask */
+
+
+/* ============================================================================
+ *                         FRAME CALLBACK
+ * ============================================================================ */
+
+#define EV_Callback_Direct    0          /**< Handler runs where the frame is decoded (ISR with EV_Decode_ISR) */
+#define EV_Callback_Deferred  1          /**< Handler runs from ev1527_Process(), frames passed through the queue */
+
+/**
+ * @brief Call a registered handler for every published frame (ev1527_OnFrame)
+ * @note The handler receives the same frames as ev1527_Data / the queue
+ *       (after the whitelist and repeat filter)
+ */
+#ifndef EV_Callback_Enable
+    #define EV_Callback_Enable  0
+#endif
+
+/**
+ * @brief Context the handler is called from
+ * @note EV_Callback_Direct: inside the decoder, i.e. in the capture ISR with
+ *       EV_Decode_ISR and in ev1527_Process() with EV_Decode_Deferred.
+ *       Lowest latency; the handler must be short and ISR safe.
+ *       EV_Callback_Deferred: ev1527_Process() drains the output queue into
+ *       the handler in main-loop context. Requires EV_Queue_Enable; while a
+ *       handler is registered ev1527_Read() finds the queue empty.
+ */
+#ifndef EV_Callback_Mode
+    #define EV_Callback_Mode  EV_Callback_Deferred
+#endif
+
+#if EV_Callback_Enable && (EV_Callback_Mode == EV_Callback_Deferred) && !EV_Queue_Enable
+    #error "EV_Callback_Deferred requires EV_Queue_Enable"
+#endif
+
+
+/* ============================================================================
+ *                         SOFT-DECISION DECODING
+ * ============================================================================ */
+
+/**
+ * @brief Keep broken EV1527 bits as erasures and vote across repeats
+ * @note Inside a frame, a pair outside the bit window (EV_pulseIsValid / adaptive
+ *       window) no longer aborts: it is stored as an erasure, up to
+ *       EV_Soft_MaxErasures per frame. A preamble or a saturated pulse still aborts.
+ *       A valid pair with an ambiguous split (HIGH/LOW within a factor of 1.25) keeps
+ *       its bit decision as a weak vote.
+ * @note Every complete frame votes on each of the EV_Data_Bits positions: 2 for a decided
+ *       bit, 1 for an ambiguous one, 0 for an erasure (positive for '1', negative
+ *       for '0'). The code is published once every position has a margin of
+ *       2 x EV_Soft_Votes; a clean frame is published at once and drops pending votes.
+ *       The votes restart after publishing, on a silent line, when a decided bit
+ *       contradicts a confirmed position, when a frame does not follow the last
+ *       merged one within its own preamble length (+25%), or after
+ *       EV_Soft_Repeats frames without a result.
+ * @note EV_Data_Bits bytes of SRAM per channel; the vote runs once per frame
+ *       (one iteration per data bit)
+ */
+#ifndef EV_Soft_Enable
+    #define EV_Soft_Enable  0
+#endif
+
+/**
+ * @brief Broken bits (outside the bit window) accepted in one frame before it is aborted
+ * @note Ambiguous splits do not count, they do not indicate a lost bit alignment
+ */
+#ifndef EV_Soft_MaxErasures
+    #define EV_Soft_MaxErasures  4
+#endif
+
+/**
+ * @brief Decided bits that confirm a bit position (margin over the opposite value)
+ * @note 1: one decided bit or two agreeing ambiguous bits confirm a position
+ *       (clean frames pass at once). 2 or more: more agreement is needed, at the
+ *       cost of latency.
+ */
+#ifndef EV_Soft_Votes
+    #define EV_Soft_Votes  1
+#endif
+
+#define EV_Soft_Margin  (2 * EV_Soft_Votes)  /**< Vote sum confirming a position */
+
+/**
+ * @brief Frames merged before unresolved votes are discarded
+ */
+#ifndef EV_Soft_Repeats
+    #define EV_Soft_Repeats  8
+#endif
+
+#if EV_Soft_Enable && ((EV_Soft_MaxErasures < 1) || (EV_Soft_MaxErasures > EV_maxIndexData))
+    #error "EV_Soft_MaxErasures must be between 1 and EV_Data_Bits - 1"
+#endif
+#if EV_Soft_Enable && ((EV_Soft_Votes < 1) || (EV_Soft_Votes > 60))
+    #error "EV_Soft_Votes must be between 1 and 60"
+#endif
+#if EV_Soft_Enable && ((EV_Soft_Repeats < 2) || (EV_Soft_Repeats > 255))
+    #error "EV_Soft_Repeats must be between 2 and 255"
+#endif
+
+/* ============================================================================
+ *                         SIGNAL QUALITY
+ * ============================================================================ */
+
+/**
+ * @brief Rate every EV1527 frame with a 3-bit link quality (ev1527_T.Bits.Quality)
+ * @note Computed from the pulses the decoder already measures, per data bit:
+ *       - split error: HIGH against its ideal share of the bit (1/4 for '0', 3/4 for '1'),
+ *         i.e. the margin left to the bit decision
+ *       - period error: bit length against the first bit of the frame (T deviation),
+ *         weighted 1/2
+ *       Quality = 7 - (mean error in 1/32 of a bit), limited to 1..7. A clean link
+ *       rates 6-7, a frame close to the bit decision threshold rates 1-2.
+ * @note Two adds and compares per bit, at most six 32-bit subtractions per frame.
+ *       Table protocol frames are not rated (Quality 0).
+ */
+#ifndef EV_Quality_Enable
+    #define EV_Quality_Enable  0
+#endif
+
+/**
+ * @brief Lowest quality published (EV_Quality_Enable)
+ * @note 0 or 1: every frame is published. 2-7: weaker EV1527 frames are dropped
+ *       before the whitelist and repeat filter, the decoder keeps running.
+ */
+#ifndef EV_Quality_Min
+    #define EV_Quality_Min  0
+#endif
+
+#if EV_Quality_Enable && ((EV_Quality_Min < 0) || (EV_Quality_Min > 7))
+    #error "EV_Quality_Min must be between 0 and 7"
+#endif
+
+/* ============================================================================
+ *                         FRAME TIMESTAMPS AND GESTURES
+ * ============================================================================ */
+
+/**
+ * @brief Attach a timestamp and repeat count to every queued frame (ev1527_ReadRecord)
+ * @note Time base: the decoder clock of the channel, the sum of all decoded pulse
+ *       durations. It is exact inside a transmission. A silent line longer than
+ *       one Timer1 period is added as whole periods counted by the overflow
+ *       interrupt (INT0 without EV_LowPower_Mode, ICP1, Shared; at most 255 periods
+ *       per gap). With EV_LowPower_Mode or EV_Capture_Software such a gap counts
+ *       as one period.
+ * @note Repeat: identical frames less than EV_HoldOff_ms apart with no silent
+ *       period in between belong to the same key press. Counted before the
+ *       repeat confirmation filter, so it also counts suppressed copies.
+ */
+#ifndef EV_Stamp_Enable
+    #define EV_Stamp_Enable  0
+#endif
+
+/**
+ * @brief Timestamp unit as a power of two of timer ticks
+ * @note Time = decoder clock >> EV_Stamp_Shift, 16 bits, rolls over.
+ *       Default 11: 2048 ticks = 1.024ms at 16MHz /8, rolls over after 67s
+ */
+#ifndef EV_Stamp_Shift
+    #define EV_Stamp_Shift  11
+#endif
+
+/**
+ * @brief Classify every record as press, repeat, long press or double click
+ * @note Runs in the decoder when the frame is published, no polling or delays
+ *       in the application. A press is reported at once; an application that
+ *       must tell a single from a double click waits EV_DoubleClick_ms for a
+ *       following EV_Gesture_Double record.
+ */
+#ifndef EV_Gesture_Enable
+    #define EV_Gesture_Enable  0
+#endif
+
+/**
+ * @brief Hold time of a key press reported as EV_Gesture_Long (ms)
+ */
+#ifndef EV_LongPress_ms
+    #define EV_LongPress_ms  800
+#endif
+
+/**
+ * @brief Maximum gap between two short presses of the same code (ms)
+ * @note Measured from the last frame of the first press to the first frame of the second
+ */
+#ifndef EV_DoubleClick_ms
+    #define EV_DoubleClick_ms  400
+#endif
+
+#define EV_Gesture_Press   0             /**< First frame of a key press */
+#define EV_Gesture_Repeat  1             /**< Further frame of a held key */
+#define EV_Gesture_Long    2             /**< Key held for EV_LongPress_ms (reported once per press) */
+#define EV_Gesture_Double  3             /**< Second short press within EV_DoubleClick_ms */
+
+#define EV_Clock_Enable       (EV_Confirm_Enable || EV_Stamp_Enable)  /**< Decoder clock kept per channel */
+#define EV_LongPress_Ticks    ((uint32_t)EV_usToTicks(EV_LongPress_ms * 1000ULL))
+#define EV_DoubleClick_Ticks  ((uint32_t)EV_usToTicks(EV_DoubleClick_ms * 1000ULL))
+
+#if EV_Stamp_Enable && !EV_Queue_Enable
+    #error "EV_Stamp_Enable requires EV_Queue_Enable"
+#endif
+#if EV_Gesture_Enable && !EV_Stamp_Enable
+    #error "EV_Gesture_Enable requires EV_Stamp_Enable"
+#endif
+#if EV_Stamp_Enable && ((EV_Stamp_Shift < 0) || (EV_Stamp_Shift > 16))
+    #error "EV_Stamp_Shift must be between 0 and 16"
+#endif
+
+/**
+ * @brief Queued frame with its decoder timestamp (EV_Stamp_Enable)
+ */
+typedef struct
+{
+    ev1527_T Code;                       /**< Frame as returned by ev1527_Read() */
+    uint16_t Time;                       /**< Decoder clock >> EV_Stamp_Shift when the frame completed */
+    uint8_t Repeat;                      /**< Copies of this key press before this one (0 = new press, saturates at 255) */
+    uint8_t Gesture;                     /**< EV_Gesture_xxx (EV_Gesture_Enable, else EV_Gesture_Press / Repeat) */
+} ev1527_Record_T;
+
+
+/* ============================================================================
+ *                         ADDRESS WHITELIST
+ * ============================================================================ */
+
+/**
+ * @brief Only publish frames from enrolled transmitter addresses
+ * @note Checked as soon as a frame is complete, before the repeat filter,
+ *       ev1527_Data and the queue: unknown remotes never reach the application
+ *       and do not stop the decoder in EV_Reception_Single
+ * @note Open addressing hash table in SRAM (3 bytes per slot), O(1) average lookup
+ */
+#ifndef EV_Whitelist_Enable
+    #define EV_Whitelist_Enable  0
+#endif
+
+/**
+ * @brief Whitelist table slots (power of two, 4 to 1024)
+ * @note Up to 3/4 of the slots can be enrolled (keeps probe chains short):
+ *       default 32 slots = 24 remotes, 96 bytes of SRAM
+ */
+#ifndef EV_Whitelist_Size
+    #define EV_Whitelist_Size  32
+#endif
+
+#if EV_Whitelist_Enable && ((EV_Whitelist_Size < 4) || (EV_Whitelist_Size > 1024) || (EV_Whitelist_Size & (EV_Whitelist_Size - 1)))
+    #error "EV_Whitelist_Size must be a power of two between 4 and 1024"
+#endif
+
+#define EV_Whitelist_Mask      (EV_Whitelist_Size - 1)        /**< Slot index wrap mask */
+#define EV_Whitelist_Capacity  ((EV_Whitelist_Size * 3) / 4)  /**< Maximum enrolled addresses */
+#define EV_Whitelist_SlotBytes ((EV_Address_Bits + 8) / 8)    /**< Bytes per slot: address + 1 and the deleted marker fit */
+
+
+/* ============================================================================
+ *                         PERSISTENT REMOTE STORE
+ * ============================================================================ */
+
+/**
+ * @brief Keep enrolled whitelist addresses in EEPROM
+ * @note The EEPROM area is split in two halves. The active half holds a
+ *       header (magic, generation, CRC16) followed by a journal of 5-byte
+ *       ADD/DEL records (20-bit address, op, CRC16 seeded with the generation).
+ * @note Wear leveling: learn/forget append one record; a full half is
+ *       compacted into the other half (live addresses only) and activated by
+ *       writing its header last, so a power loss never loses the old copy.
+ * @note Lazy load: ev1527_Init() only reads the two headers, records are
+ *       replayed into the whitelist by ev1527_Process() (EV_Store_LoadBatch per call)
+ * @note Requires EV_Whitelist_Enable
+ */
+#ifndef EV_Store_Enable
+    #define EV_Store_Enable  0
+#endif
+
+/**
+ * @brief First EEPROM byte used by the store
+ */
+#ifndef EV_Store_Base
+    #define EV_Store_Base  0
+#endif
+
+/**
+ * @brief EEPROM bytes used by the store (both halves)
+ * @note Default: room for 2×EV_Whitelist_Capacity records per half
+ *       (488 bytes for the default 32-slot whitelist)
+ */
+#ifndef EV_Store_Size
+    #define EV_Store_Size  (2 * (4 + 5 * 2 * EV_Whitelist_Capacity))
+#endif
+
+/**
+ * @brief Journal records replayed per ev1527_Process() call while loading
+ */
+#ifndef EV_Store_LoadBatch
+    #define EV_Store_LoadBatch  8
+#endif
+
+#define EV_Store_HalfSize  (EV_Store_Size / 2)                /**< Bytes per half */
+#define EV_Store_Records   ((EV_Store_HalfSize - 4) / 5)      /**< Journal records per half */
+
+#if EV_Store_Enable && !EV_Whitelist_Enable
+    #error "EV_Store_Enable requires EV_Whitelist_Enable"
+#endif
+
+#if EV_Store_Enable && (EV_Address_Bits > 20)
+    #error "EV_Store_Enable records hold up to 20 address bits (EV_Data_Bits - EV_Key_Bits)"
+#endif
+
+#if EV_Store_Enable && (EV_Store_Records <= EV_Whitelist_Capacity)
+    #error "EV_Store_Size too small: each half must hold more than EV_Whitelist_Capacity records"
+#endif
+
+#if EV_Store_Enable && defined(E2END) && ((EV_Store_Base + EV_Store_Size - 1) > E2END)
+    #error "EV_Store_Base + EV_Store_Size exceeds the EEPROM of this device"
+#endif
+
+
+/* ============================================================================
+ *                         LOW-POWER RECEPTION
+ * ============================================================================ */
+
+#define EV_LowPower_Off        0         /**< No sleep support, Timer1 always running (default) */
+#define EV_LowPower_Idle       1         /**< ev1527_Idle() uses SLEEP_MODE_IDLE */
+#define EV_LowPower_PowerSave  2         /**< ev1527_Idle() uses SLEEP_MODE_PWR_SAVE between frames (INT0 backend) */
+
+/**
+ * @brief Low-power reception mode
+ * @note With EV_Capture_INT0 Timer1 is gated off until the first edge and
+ *       gated off again when no edge arrives for a full timer period
+ *       (TIMER1_OVF_vect is used as idle timeout)
+ * @note EV_LowPower_PowerSave wakes on PD2 pin change (PCINT18, uses PCINT2_vect);
+ *       the wake-up edge itself is not measured, typically the first repeat
+ *       of a transmission is lost while the oscillator starts up
+ */
+#ifndef EV_LowPower_Mode
+    #define EV_LowPower_Mode  EV_LowPower_Off
+#endif
+
+#if (EV_LowPower_Mode == EV_LowPower_PowerSave) && (EV_Capture_Mode != EV_Capture_INT0)
+    #error "EV_LowPower_PowerSave requires EV_Capture_INT0 (input capture needs the I/O clock)"
+#endif
+
+
+/* ============================================================================
+ *                         RECEIVER CHANNELS
+ * ============================================================================ */
+
+#define EV_Source_None    0              /**< Channel not bound */
+#define EV_Source_INT0    1              /**< INT0 (PD2), any-change edge interrupt */
+#define EV_Source_INT1    2              /**< INT1 (PD3), any-change edge interrupt */
+#define EV_Source_PCINT0  3              /**< Pin change group 0 (PORTB, PCINT0_vect) */
+#define EV_Source_PCINT1  4              /**< Pin change group 1 (PORTC, PCINT1_vect) */
+#define EV_Source_PCINT2  5              /**< Pin change group 2 (PORTD, PCINT2_vect) */
+
+/**
+ * @brief Number of independent receiver channels (1 to 4)
+ * @note Every channel owns a complete decoder context (state machine, adaptive
+ *       thresholds, repeat filter and deferred pulse ring). All channels share
+ *       one free-running Timer1 and feed the same output queue, frames are
+ *       tagged with ev1527_T.Bits.Channel.
+ * @note More than one channel requires EV_Capture_Shared (or EV_Capture_Software)
+ */
+#ifndef EV_Channel_Count
+    #define EV_Channel_Count  1
+#endif
+
+/**
+ * @brief Channel to pin binding (EV_Capture_Shared only)
+ * @note EV_ChannelN_Source: EV_Source_INT0 / INT1 / PCINT0 / PCINT1 / PCINT2
+ *       EV_ChannelN_Pin: bit number within the port of a PCINT group (ignored for INT0/INT1)
+ *       Several channels may share one pin change group, INT0/INT1 serve one channel each.
+ */
+#ifndef EV_Channel0_Source
+    #define EV_Channel0_Source  EV_Source_INT0
+#endif
+#ifndef EV_Channel0_Pin
+    #define EV_Channel0_Pin  0
+#endif
+#ifndef EV_Channel1_Source
+    #define EV_Channel1_Source  EV_Source_None
+#endif
+#ifndef EV_Channel1_Pin
+    #define EV_Channel1_Pin  0
+#endif
+#ifndef EV_Channel2_Source
+    #define EV_Channel2_Source  EV_Source_None
+#endif
+#ifndef EV_Channel2_Pin
+    #define EV_Channel2_Pin  0
+#endif
+#ifndef EV_Channel3_Source
+    #define EV_Channel3_Source  EV_Source_None
+#endif
+#ifndef EV_Channel3_Pin
+    #define EV_Channel3_Pin  0
+#endif
+
+#if (EV_Channel_Count < 1) || (EV_Channel_Count > 4)
+    #error "EV_Channel_Count must be between 1 and 4"
+#endif
+
+#if (EV_Channel_Count > 1) && (EV_Capture_Mode != EV_Capture_Shared) && (EV_Capture_Mode != EV_Capture_Software)
+    #error "EV_Channel_Count > 1 requires EV_Capture_Shared or EV_Capture_Software"
+#endif
+
+#if (EV_Capture_Mode == EV_Capture_Shared) && (EV_LowPower_Mode == EV_LowPower_PowerSave)
+    #error "EV_LowPower_PowerSave requires EV_Capture_INT0 (shared timebase must keep counting)"
+#endif
+
+
+/* ============================================================================
+ *                         GLITCH FILTER
+ * ============================================================================ */
+
+/**
+ * @brief Merge pulses shorter than EV_Glitch_us into the surrounding pulse
+ * @note Runs in the capture ISR ahead of the decoder, per channel. Each pulse is
+ *       held back until the next one proves it is not cut by a glitch:
+ *       X(a) Y(g<min) X(b) reaches the decoder as one X(a+g+b), so HIGH/LOW
+ *       pairing is never corrupted. Bursts of glitches are folded the same way.
+ * @note A glitch costs a compare and an add in the ISR, the decoder is not run
+ * @note Adds one pulse of latency: a frame is published when the pulse after
+ *       its last bit ends
+ */
+#ifndef EV_Glitch_Enable
+    #define EV_Glitch_Enable  0
+#endif
+
+/**
+ * @brief Shortest pulse passed to the decoder, in µs
+ * @note Default 100µs: removes the sub-100µs spikes of superheterodyne
+ *       receivers (RXB6 ...) between frames, well below the 1×T pulse (~300µs)
+ */
+#ifndef EV_Glitch_us
+    #define EV_Glitch_us  100
+#endif
+
+#define EV_Glitch_Ticks  ((uint16_t)EV_usToTicks(EV_Glitch_us))  /**< Glitch threshold in timer ticks */
+
+#if EV_Glitch_Enable && ((EV_Glitch_us * 2) > EV_Pulse_min_us)
+    #error "EV_Glitch_us must not exceed EV_Pulse_min_us / 2"
+#endif
+
+
+/* ============================================================================
+ *                         NOISE STORM LIMITER
+ * ============================================================================ */
+
+/**
+ * @brief Mask the edge interrupt while the receiver outputs pure noise
+ * @note Edges are counted per EV_Storm_Window_us of signal time in the capture
+ *       ISR (any pulse longer than the window, like a preamble, restarts it).
+ *       When EV_Storm_Edges arrive within one window the edge interrupt is
+ *       masked and Timer1 compare A takes over:
+ *       1. Back-off: EV_Storm_Backoff_us without looking at the pin
+ *       2. Sampling: the data pin is read every EV_Storm_Sample_us; once it reads
+ *          LOW EV_Storm_Quiet times in a row (a preamble gap, longer than any
+ *          bit pulse) the edge interrupt is re-armed and decoding resumes
+ * @note Bounds the decoder load during a storm to EV_Storm_Edges edge interrupts
+ *       per back-off cycle plus one short sampling interrupt per EV_Storm_Sample_us.
+ *       The frame whose preamble re-armed the decoder is lost, repeats decode.
+ * @note EV_Capture_INT0 (not with EV_LowPower_Mode) or EV_Capture_ICP1,
+ *       uses TIMER1_COMPA_vect
+ */
+#ifndef EV_Storm_Enable
+    #define EV_Storm_Enable  0
+#endif
+
+/**
+ * @brief Storm detection: edges per window
+ * @note Default 64 edges in 10ms. EV1527 frames produce about 17 edges per 10ms,
+ *       HT12E at its shortest T about 45
+ */
+#ifndef EV_Storm_Window_us
+    #define EV_Storm_Window_us  10000
+#endif
+#ifndef EV_Storm_Edges
+    #define EV_Storm_Edges  64
+#endif
+
+/**
+ * @brief Back-off and sampling timing
+ * @note Default: 50ms back-off, 1ms sampling, 4 LOW samples (> 3ms steady LOW)
+ */
+#ifndef EV_Storm_Backoff_us
+    #define EV_Storm_Backoff_us  50000
+#endif
+#ifndef EV_Storm_Sample_us
+    #define EV_Storm_Sample_us  1000
+#endif
+#ifndef EV_Storm_Quiet
+    #define EV_Storm_Quiet  4
+#endif
+
+#define EV_Storm_Window_Ticks  ((uint16_t)EV_usToTicks(EV_Storm_Window_us))   /**< Detection window in timer ticks */
+#define EV_Storm_Sample_Ticks  ((uint16_t)EV_usToTicks(EV_Storm_Sample_us))   /**< Sampling period in timer ticks */
+#define EV_Storm_Backoff_Samples  ((EV_Storm_Backoff_us + EV_Storm_Sample_us - 1) / EV_Storm_Sample_us)  /**< Back-off in sampling periods */
+
+#if EV_Storm_Enable && (EV_Capture_Mode != EV_Capture_INT0) && (EV_Capture_Mode != EV_Capture_ICP1)
+    #error "EV_Storm_Enable requires EV_Capture_INT0 or EV_Capture_ICP1"
+#endif
+
+#if EV_Storm_Enable && (EV_Capture_Mode == EV_Capture_INT0) && (EV_LowPower_Mode != EV_LowPower_Off)
+    #error "EV_Storm_Enable needs Timer1 running, not available with EV_LowPower_Mode on EV_Capture_INT0"
+#endif
+
+#if EV_Storm_Enable && ((EV_usToTicks(EV_Storm_Window_us) > 0xFFFF) || (EV_usToTicks(EV_Storm_Sample_us) > 0xFFFF))
+    #error "EV_Storm_Window_us and EV_Storm_Sample_us must fit in 16 timer bits"
+#endif
+
+#if EV_Storm_Enable && ((EV_Storm_Edges < 2) || (EV_Storm_Edges > 255) || (EV_Storm_Quiet < 1) || (EV_Storm_Backoff_Samples > 255))
+    #error "EV_Storm_Edges must be 2-255, EV_Storm_Quiet at least 1, back-off at most 255 sampling periods"
+#endif
+
+
+/* ============================================================================
+ *                         RAW CAPTURE AND DIAGNOSTICS
+ * ============================================================================ */
+
+/**
+ * @brief Raw pulse capture mode for field diagnostics
+ * @note ev1527_RawStart() diverts the pulses of one channel into a RAM buffer
+ *       straight from the capture ISR, nothing is decoded on that channel until
+ *       ev1527_RawStop(). Each entry is packed like the deferred ring:
+ *       duration in ticks with bit 0 = level of the pulse (EV_Level_Low/High).
+ * @note ev1527_RawDump() streams the buffer in a compact binary format for
+ *       host-side replay and threshold tuning (all fields little-endian):
+ *       'E' 'V' 'R' version(1) | tick_ns(2) | count(2) | count × entry(2) | CRC16(2)
+ *       CRC16 (poly 0xA001, init 0xFFFF) covers every byte before it
+ */
+#ifndef EV_Raw_Enable
+    #define EV_Raw_Enable  0
+#endif
+
+/**
+ * @brief Raw buffer size in pulses (16 to 2048, 2 bytes each)
+ * @note One EV1527 frame is 50 pulses, default 128 pulses = 256 bytes of SRAM
+ */
+#ifndef EV_Raw_Size
+    #define EV_Raw_Size  128
+#endif
+
+/**
+ * @brief Built-in USART0 sink for ev1527_RawDump(NULL)
+ * @note Polls UDRE0 and writes UDR0; USART0 baud rate and frame format
+ *       must be configured by the application
+ */
+#ifndef EV_Raw_UART
+    #define EV_Raw_UART  1
+#endif
+
+#if EV_Raw_Enable && ((EV_Raw_Size < 16) || (EV_Raw_Size > 2048))
+    #error "EV_Raw_Size must be between 16 and 2048"
+#endif
+
+#define EV_Raw_Version  1                                    /**< Dump format version */
+#define EV_Raw_TickNs   ((EV_Timer_Prescaler * 1000000000ULL) / F_CPU)  /**< Tick length in the dump header */
+
+/**
+ * @brief Debug pulse on PC0 for logic analyzer verification
+ * @note PC0 is driven HIGH while each captured pulse is handled (decoding in
+ *       EV_Decode_ISR, ring push in EV_Decode_Deferred), so the width shows
+ *       the decoder cost and the rate shows the edge rate
+ */
+#ifndef EV_Debug_Enable
+    #define EV_Debug_Enable  0
+#endif
+
+/* ============================================================================
+ *                         DECODER STATISTICS
+ * ============================================================================ */
+
+/**
+ * @brief Decoder statistics counters for RF link quality reporting
+ * @note Incremented at the existing decision points of the decoder,
+ *       all channels are summed, counters saturate at their maximum
+ * @note Preambles / aborts are counted for the EV1527 decoder, frames for
+ *       every protocol (before the whitelist and repeat filter)
+ */
+#ifndef EV_Stats_Enable
+    #define EV_Stats_Enable  0
+#endif
+
+#if EV_Stats_Enable
+typedef struct
+{
+    uint16_t Preambles;                  /**< EV1527 preambles detected */
+    uint16_t Frames;                     /**< Complete frames decoded (all protocols) */
+    uint16_t Aborts;                     /**< Frames aborted by an invalid bit (EV_pulseIsValid / adaptive window) */
+    uint8_t  abortIndex[EV_maxIndexData + 1];  /**< Aborted frames per bit index (0 to EV_maxIndexData) */
+    uint16_t queueOverflow;              /**< Frames dropped on a full output queue */
+    uint16_t pulseDropped;               /**< Pulses dropped on a full deferred ring */
+    uint16_t Erasures;                   /**< EV1527 bits kept as erasures (EV_Soft_Enable) */
+    uint16_t Glitches;                   /**< Pulses merged by the glitch filter (EV_Glitch_Enable) */
+    uint16_t Storms;                     /**< Noise storms that masked the edge interrupt (EV_Storm_Enable) */
+    uint16_t isrMax;                     /**< Longest pulse handling in the capture ISR, in timer ticks */
+} ev1527_Stats_T;
+#endif
+
+/* ============================================================================
+ *                         CYCLE BENCHMARK
+ * ============================================================================ */
+
+#define EV_Path_High      0              /**< HIGH pulse stored (inverted table protocols stepped) */
+#define EV_Path_Hunt      1              /**< Pair checked for a preamble, none found */
+#define EV_Path_Preamble  2              /**< Preamble detected, frame decoding starts */
+#define EV_Path_Bit       3              /**< Data bit decoded */
+#define EV_Path_Frame     4              /**< Last bit: frame published (ev1527_deInit in EV_Reception_Single) */
+#define EV_Path_Abort     5              /**< Invalid bit: frame reset */
+#define EV_Path_Count     6
+
+/**
+ * @brief Per-path cycle measurement of the decoder state machine
+ * @note Every call of the pulse decoder is timed on Timer1 and recorded
+ *       under the path it took (EV_Path_xxx): count, min, max, sum and a
+ *       histogram. Resolution is EV_Timer_Prescaler CPU cycles (8 by default),
+ *       single cycles with EV_Bench_Timer0; with EV_Capture_Software
+ *       ev1527_Init() runs Timer1 at /1 for exact cycles
+ * @note Measures the decoder itself (same cost in ISR or deferred mode),
+ *       the interrupt entry and the backend timer read are not included
+ * @note In EV_Reception_Single the timer is stopped by ev1527_deInit() at the
+ *       end of the Frame path: benchmark the Frame path in EV_Reception_Continuous
+ */
+#ifndef EV_Bench_Enable
+    #define EV_Bench_Enable  0
+#endif
+
+/**
+ * @brief Histogram bin width in CPU cycles and number of bins
+ * @note The last bin also collects everything above its lower bound
+ */
+#ifndef EV_Bench_BinCycles
+    #define EV_Bench_BinCycles  32
+#endif
+#ifndef EV_Bench_Bins
+    #define EV_Bench_Bins  16
+#endif
+
+/**
+ * @brief Exact cycle counts with the hardware capture backends
+ * @note 1: ev1527_Init() also runs Timer0 free at /1 (normal mode, no
+ *       interrupt). Its 8-bit count gives the low bits of each call, Timer1
+ *       the coarse value: together they resolve single CPU cycles for
+ *       EV_Timer_Prescaler up to 64. Timer0 is then owned by the benchmark
+ *       (no millis(), no Timer0 PWM in the application)
+ * @note No effect with EV_Capture_Software (Timer1 runs at /1 already)
+ */
+#ifndef EV_Bench_Timer0
+    #define EV_Bench_Timer0  0
+#endif
+
+#if EV_Bench_Enable && (EV_Capture_Mode == EV_Capture_Software)
+    #define EV_Bench_CyclesPerTick  1                        /**< Timer1 at /1 while benchmarking */
+    #define EV_Bench_Exact          0
+#else
+    #define EV_Bench_CyclesPerTick  EV_Timer_Prescaler
+    #define EV_Bench_Exact          (EV_Bench_Enable && EV_Bench_Timer0)
+#endif
+
+#if EV_Bench_Exact && (EV_Timer_Prescaler > 64)
+    #error "EV_Bench_Timer0 needs EV_Timer_Prescaler <= 64 (Timer0 wraps every 256 cycles)"
+#endif
+
+#if EV_Bench_Enable
+typedef struct
+{
+    uint16_t Count;                      /**< Recorded calls (saturates at 65535) */
+    uint16_t Min;                        /**< Fastest call in cycles (0 if none) */
+    uint16_t Max;                        /**< Slowest call in cycles */
+    uint32_t Sum;                        /**< Total cycles of the counted calls (average = Sum / Count) */
+    uint16_t Histogram[EV_Bench_Bins];   /**< Calls per EV_Bench_BinCycles wide bin */
+} ev1527_Bench_T;
+#endif
+
+
+/* ============================================================================
+ *                         RF TRANSMITTER
+ * ============================================================================ */
+
+#define EV_Tx_OC2A  0                    /**< PB3 (Arduino D11, shared with SPI MOSI) */
+#define EV_Tx_OC2B  1                    /**< PD3 (Arduino D3, shared with INT1) */
+
+/**
+ * @brief Send EV1527 frames with ev1527_Transmit()
+ * @note Timer2 in CTC mode drives the compare output pin in hardware: every
+ *       edge is set by the compare match itself, TIMER2_COMPA_vect only loads
+ *       the next interval. ISR latency (e.g. the receiver's capture ISR) does
+ *       not move an edge, the CPU is free between edges.
+ * @note Waveform per frame: sync HIGH 1T + LOW 31T, then EV_Data_Bits bits
+ *       ('0' = HIGH 1T + LOW 3T, '1' = HIGH 3T + LOW 1T, first bit = bit 0);
+ *       a final 1T HIGH pulse closes the last bit. Checked at compile time
+ *       against the decoder's T range, bit window, bit ratio and preamble check.
+ * @note Independent of Timer1 and of the capture backend
+ */
+#ifndef EV_Tx_Enable
+    #define EV_Tx_Enable  0
+#endif
+
+/**
+ * @brief Transmitted base period T in µs
+ */
+#ifndef EV_Tx_T_us
+    #define EV_Tx_T_us  320
+#endif
+
+/**
+ * @brief Timer2 prescaler (1, 8, 32, 64, 128, 256 or 1024)
+ * @note Default /64: 4µs resolution at 16MHz. Intervals longer than 256
+ *       ticks are split into several compare periods without an edge.
+ */
+#ifndef EV_Tx_Prescaler
+    #define EV_Tx_Prescaler  64
+#endif
+
+/**
+ * @brief Output pin: EV_Tx_OC2A (PB3) or EV_Tx_OC2B (PD3)
+ */
+#ifndef EV_Tx_Output
+    #define EV_Tx_Output  EV_Tx_OC2A
+#endif
+
+#define EV_Tx_Sync_T  31                 /**< Sync LOW in T, centre of the 25-40× EV_PrembleCheck window */
+
+#if   EV_Tx_Prescaler == 1
+    #define EV_Tx_CS  0x01               /**< CS22:CS20 = 001 */
+#elif EV_Tx_Prescaler == 8
+    #define EV_Tx_CS  0x02               /**< CS22:CS20 = 010 */
+#elif EV_Tx_Prescaler == 32
+    #define EV_Tx_CS  0x03               /**< CS22:CS20 = 011 */
+#elif EV_Tx_Prescaler == 64
+    #define EV_Tx_CS  0x04               /**< CS22:CS20 = 100 */
+#elif EV_Tx_Prescaler == 128
+    #define EV_Tx_CS  0x05               /**< CS22:CS20 = 101 */
+#elif EV_Tx_Prescaler == 256
+    #define EV_Tx_CS  0x06               /**< CS22:CS20 = 110 */
+#elif EV_Tx_Prescaler == 1024
+    #define EV_Tx_CS  0x07               /**< CS22:CS20 = 111 */
+#else
+    #error "EV_Tx_Prescaler must be 1, 8, 32, 64, 128, 256 or 1024"
+#endif
+
+#define EV_Tx_usToTicks(_us)  (((_us) * (F_CPU / 1000ULL)) / (EV_Tx_Prescaler * 1000ULL))  /**< µs to Timer2 ticks (constants only) */
+#define EV_Tx_Tick_T     ((uint16_t)EV_Tx_usToTicks(EV_Tx_T_us))        /**< 1T in Timer2 ticks */
+#define EV_Tx_Tick_3T    ((uint16_t)(3 * EV_Tx_Tick_T))                  /**< Long bit pulse */
+#define EV_Tx_Tick_Sync  ((uint16_t)(EV_Tx_Sync_T * EV_Tx_Tick_T))       /**< Sync LOW */
+
+#if EV_Tx_Enable && (EV_Tx_usToTicks(EV_Tx_T_us) < 16)
+    #error "EV_Tx_T_us is below 16 Timer2 ticks - select a smaller EV_Tx_Prescaler"
+#endif
+#if EV_Tx_Enable && ((EV_Tx_Sync_T * EV_Tx_usToTicks(EV_Tx_T_us)) > 0xFFFF)
+    #error "EV_Tx_Sync_T × EV_Tx_T_us does not fit in 16 bits of Timer2 ticks - select a larger EV_Tx_Prescaler"
+#endif
+#if EV_Tx_Enable && ((EV_Tx_T_us < EV_T_min_us) || (EV_Tx_T_us > EV_T_Max_us) || ((4 * EV_Tx_T_us) <= EV_Pulse_min_us) || ((4 * EV_Tx_T_us) >= EV_Pulse_Max_us))
+    #error "EV_Tx_T_us is outside the T range / bit window accepted by the decoder"
+#endif
+#if EV_Tx_Enable && (((EV_bitRatio_Den * 3) < EV_bitRatio_Num) || (EV_bitRatio_Den >= (EV_bitRatio_Num * 3)))
+    #error "EV_bitRatio_Num / EV_bitRatio_Den do not separate the transmitted 3:1 and 1:3 bits"
+#endif
+
+/* ============================================================================
+ *                         FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Initialize EV1527 decoder hardware (Timer1 and external interrupt)
+ * @retval None
+ * @note Capture backend is selected at build time with EV_Capture_Mode
+ *       (EV_Capture_INT0, EV_Capture_ICP1 or EV_Capture_Shared)
+ * @note Initialization sequence:
+ *       1. Configure Timer1 for pulse width measurement
+ *          - Set prescaler for µs resolution (typically /8 at 16MHz)
+ *          - Enable normal counting mode (count up from 0)
+ *       2. Configure external interrupt on RF data pin
+ *          - Set to trigger on both edges (rising and falling)
+ *          - Enable interrupt for pulse detection
+ *       3. Initialize global variables for decoding state machine
+ * @note Must be called before attempting to decode RF signals
+ * @note Global interrupts (sei()) must be enabled for operation
+ */
+void ev1527_Init(void);
+
+/**
+ * @brief Disable EV1527 decoder and release hardware resources
+ * @retval None
+ * @note Deinitialization sequence:
+ *       1. Disable external interrupt (stop pulse detection)
+ *       2. Stop Timer1 (disable clock source)
+ *       3. Clear any pending interrupt flags
+ *       4. Reset decoder state machine variables
+ * @note Use this to save power when RF reception not needed
+ *       or before reconfiguring hardware for other purposes
+ */
+void ev1527_deInit(void);
+
+/**
+ * @brief Run the deferred decoder state machine
+ * @retval None
+ * @note EV_Decode_Deferred: decodes all pulses queued by the capture ISR,
+ *       must be called regularly from the main loop
+ * @note EV_Decode_ISR: empty, safe to call
+ * @note EV_Store_Enable: also loads the EEPROM store and saves remotes enrolled
+ *       by ev1527_LearnNext(), call it from the main loop in every decode mode
+ */
+void ev1527_Process(void);
+
+#if EV_LowPower_Mode != EV_LowPower_Off
+/**
+ * @brief Sleep until the next RF edge or application interrupt
+ * @retval None
+ * @note Call from the main loop after ev1527_Process() / ev1527_Read();
+ *       global interrupts are enabled on return
+ * @note Does not sleep if a frame was published since the previous call
+ */
+void ev1527_Idle(void);
+#endif
+
+#if EV_Queue_Enable
+/**
+ * @brief Number of decoded frames waiting in the output queue
+ * @retval Frame count
+ */
+uint8_t ev1527_Available(void);
+
+/**
+ * @brief Take the oldest decoded frame from the output queue
+ * @param _Code: Pointer to destination frame
+ * @retval true if a frame was read, false if the queue is empty
+ * @note Safe against the ISR without disabling interrupts
+ */
+bool ev1527_Read(ev1527_T *_Code);
+
+/**
+ * @brief Number of frames dropped because the queue was full
+ * @retval Overflow counter (saturates at 255)
+ */
+uint8_t ev1527_Overflow(void);
+
+#if EV_Stamp_Enable
+/**
+ * @brief Take the oldest queued frame together with its timestamp and repeat count
+ * @param _Record: Pointer to destination record
+ * @retval true if a record was read, false if the queue is empty
+ * @note Same queue as ev1527_Read(), each frame is returned by one of the two
+ */
+bool ev1527_ReadRecord(ev1527_Record_T *_Record);
+#endif
+#endif
+
+/**
+ * @brief Atomically take the latest frame from ev1527_Data and clear its Detect flag
+ * @param _Code: Destination for the frame
+ * @retval true if a new frame was pending (Detect was set)
+ * @note Replaces polling and clearing ev1527_Data.Bits.Detect by hand, which
+ *       races with the decoder writing rawValue and rawTag
+ */
+bool ev1527_Take(ev1527_T *_Code);
+
+#if EV_Callback_Enable
+/**
+ * @brief Frame handler, receives a copy of the published frame (Detect set)
+ */
+typedef void (*ev1527_Handler_T)(ev1527_T _Code);
+
+/**
+ * @brief Register the frame handler
+ * @param _Handler: Function to call for every frame, NULL to unregister
+ * @retval None
+ * @note Called from the context selected by EV_Callback_Mode
+ */
+void ev1527_OnFrame(ev1527_Handler_T _Handler);
+#endif
+
+#if EV_Whitelist_Enable
+/**
+ * @brief Enroll a transmitter address
+ * @param _Address: Transmitter address (ev1527_T.Bits.Address)
+ * @retval true if enrolled or already known, false if the table is full
+ */
+bool ev1527_Learn(uint32_t _Address);
+
+/**
+ * @brief Remove a transmitter address
+ * @param _Address: Transmitter address
+ * @retval true if the address was enrolled
+ */
+bool ev1527_Forget(uint32_t _Address);
+
+/**
+ * @brief Remove all enrolled addresses
+ * @retval None
+ */
+void ev1527_ForgetAll(void);
+
+/**
+ * @brief Check if a transmitter address is enrolled
+ * @param _Address: Transmitter address
+ * @retval true if enrolled
+ */
+bool ev1527_Known(uint32_t _Address);
+
+/**
+ * @brief Enroll the next received frame (pairing mode)
+ * @param _Enable: true to arm, false to cancel
+ * @retval None
+ * @note The next complete frame from any address is enrolled and published,
+ *       then pairing ends automatically
+ */
+void ev1527_LearnNext(bool _Enable);
+
+/**
+ * @brief Number of enrolled addresses
+ * @retval Enrolled count (0 to EV_Whitelist_Capacity)
+ */
+uint16_t ev1527_KnownCount(void);
+
+#if EV_Store_Enable
+/**
+ * @brief Check if the EEPROM store has been loaded into the whitelist
+ * @retval true when all records are replayed
+ * @note Loading runs in ev1527_Process(); ev1527_Learn / ev1527_Forget / ev1527_Known
+ *       finish it on demand
+ */
+bool ev1527_StoreReady(void);
+#endif
+#endif
+
+#if EV_Capture_Mode == EV_Capture_Software
+/**
+ * @brief Feed one measured pulse to the decoder (EV_Capture_Software)
+ * @param _Channel: Channel index (0 to EV_Channel_Count-1)
+ * @param _Ticks: Pulse duration in timebase ticks (EV_usToTicks), EV_Tick_Overflow if longer
+ * @param _Level: EV_Level_High or EV_Level_Low, level of the pulse that just ended
+ * @retval None
+ * @note Call order must follow the signal: HIGH and LOW pulses alternate
+ */
+void ev1527_Feed(uint8_t _Channel, uint16_t _Ticks, uint8_t _Level);
+#endif
+
+#if EV_Stats_Enable
+/**
+ * @brief Take a consistent snapshot of the decoder statistics
+ * @param _Stats: Destination
+ * @param _Clear: true to reset all counters after the copy
+ * @retval None
+ * @note Copied with interrupts disabled, no count is lost between copy and clear
+ */
+void ev1527_GetStats(ev1527_Stats_T *_Stats, bool _Clear);
+#endif
+
+#if EV_Bench_Enable
+/**
+ * @brief Read the cycle measurement of one decoder path
+ * @param _Path: EV_Path_xxx
+ * @param _Bench: Destination
+ * @param _Clear: true to restart the measurement of this path after the copy
+ * @retval None
+ */
+void ev1527_GetBench(uint8_t _Path, ev1527_Bench_T *_Bench, bool _Clear);
+#endif
+
+#if EV_Raw_Enable
+/**
+ * @brief Byte sink for ev1527_RawDump (e.g. a UART transmit function)
+ */
+typedef void (*ev1527_RawPut_T)(uint8_t _Byte);
+
+/**
+ * @brief Start raw capture on one channel
+ * @param _Channel: Channel index (0 to EV_Channel_Count-1)
+ * @retval None
+ * @note Clears the raw buffer and resets that channel's decoder; capture
+ *       stops by itself when the buffer is full
+ */
+void ev1527_RawStart(uint8_t _Channel);
+
+/**
+ * @brief Stop raw capture and resume decoding
+ * @retval None
+ * @note The buffer is kept and can still be dumped
+ */
+void ev1527_RawStop(void);
+
+/**
+ * @brief Number of pulses in the raw buffer
+ * @retval 0 to EV_Raw_Size
+ */
+uint16_t ev1527_RawCount(void);
+
+/**
+ * @brief Stream the raw buffer in binary dump format
+ * @param _Put: Byte sink, NULL selects the built-in USART0 sink (EV_Raw_UART)
+ * @retval Number of pulses sent
+ * @note Blocking; may be called while capture is still running, the
+ *       pulses present at the call are sent
+ */
+uint16_t ev1527_RawDump(ev1527_RawPut_T _Put);
+#endif
+
+#if EV_Tx_Enable
+/**
+ * @brief Start sending a code in the background
+ * @param _Code: Code to send (Bits.Address / Bits.Keys, tag bits are ignored);
+ *        a decoded frame can be replayed as it is
+ * @param _Repeats: Number of frames (1-255), remotes typically send 8-20
+ * @retval true if started, false if a transmission is running or _Repeats is 0
+ * @note Returns at once; Timer2 and TIMER2_COMPA_vect shape every edge.
+ *       (32 + 4 × EV_Data_Bits) × T per frame: 41ms at T = 320µs.
+ * @note A local receiver decodes the frames too (same code, EV_Proto_EV1527)
+ */
+bool ev1527_Transmit(ev1527_T _Code, uint8_t _Repeats);
+
+/**
+ * @brief Check for a running transmission
+ * @retval true until the final edge of the last frame is out
+ */
+bool ev1527_TxBusy(void);
+#endif
 
 #endif /* _ev1527_H_ */
\ No newline at end of file
@@ -0,0 +1,230 @@
+/**
+ ******************************************************************************
+ * @file     ev1527_config.h
+ * @brief    Build configuration of the EV1527 library
+ *
+ * @author   Hossein Bagheri
+ * @github   https://github.com/aKaReZa75
+ *
+ * @note     Included by ev1527.h before its defaults. Every option defined
+ *           here overrides the #ifndef default in ev1527.h, options left out
+ *           keep their default. Compiler flags (-D) still win over this file.
+ *
+ * @note     A disabled feature is removed by the preprocessor: its code, its
+ *           ISR, its static variables and its ev1527_Channel_T fields are not
+ *           compiled, so it costs neither flash nor SRAM.
+ *
+ * @note     Profiles (EV_Config_Profile):
+ *           - EV_Profile_Default : ev1527.h defaults, single INT0 channel,
+ *                                  decoder in the ISR, 8-entry frame queue
+ *           - EV_Profile_Minimal : ev1527_Data / ev1527_Take only, every
+ *                                  optional feature off
+ *                                  (Examples/size/size_report.sh measures it)
+ ******************************************************************************
+ */
+#ifndef _ev1527_config_H_
+#define _ev1527_config_H_
+
+
+/* ============================================================================
+ *                         CONFIGURATION PROFILE
+ * ============================================================================ */
+
+#define EV_Profile_Default  0            /**< ev1527.h defaults */
+#define EV_Profile_Minimal  1            /**< Smallest build for parts with a few hundred bytes of SRAM */
+
+#ifndef EV_Config_Profile
+    #define EV_Config_Profile  EV_Profile_Default
+#endif
+
+#if EV_Config_Profile == EV_Profile_Minimal
+    /* Output: ev1527_Data only */
+    #ifndef EV_Queue_Enable
+        #define EV_Queue_Enable  0
+    #endif
+    #ifndef EV_Callback_Enable
+        #define EV_Callback_Enable  0
+    #endif
+    /* Decoder: one channel, in the capture ISR, EV1527 only */
+    #ifndef EV_Channel_Count
+        #define EV_Channel_Count  1
+    #endif
+    #ifndef EV_Decode_Mode
+        #define EV_Decode_Mode  0            /**< EV_Decode_ISR */
+    #endif
+    #ifndef EV_Adaptive_T
+        #define EV_Adaptive_T  0
+    #endif
+    #ifndef EV_Protocol_PT2262
+        #define EV_Protocol_PT2262  0
+    #endif
+    #ifndef EV_Protocol_HT12E
+        #define EV_Protocol_HT12E  0
+    #endif
+    /* Filters */
+    #ifndef EV_Confirm_Enable
+        #define EV_Confirm_Enable  0
+    #endif
+    #ifndef EV_Soft_Enable
+        #define EV_Soft_Enable  0
+    #endif
+    #ifndef EV_Quality_Enable
+        #define EV_Quality_Enable  0
+    #endif
+    #ifndef EV_Stamp_Enable
+        #define EV_Stamp_Enable  0
+    #endif
+    #ifndef EV_Gesture_Enable
+        #define EV_Gesture_Enable  0
+    #endif
+    #ifndef EV_Whitelist_Enable
+        #define EV_Whitelist_Enable  0
+    #endif
+    #ifndef EV_Store_Enable
+        #define EV_Store_Enable  0
+    #endif
+    #ifndef EV_Glitch_Enable
+        #define EV_Glitch_Enable  0
+    #endif
+    #ifndef EV_Storm_Enable
+        #define EV_Storm_Enable  0
+    #endif
+    /* Diagnostics and transmitter */
+    #ifndef EV_Raw_Enable
+        #define EV_Raw_Enable  0
+    #endif
+    #ifndef EV_Debug_Enable
+        #define EV_Debug_Enable  0
+    #endif
+    #ifndef EV_Stats_Enable
+        #define EV_Stats_Enable  0
+    #endif
+    #ifndef EV_Bench_Enable
+        #define EV_Bench_Enable  0
+    #endif
+    #ifndef EV_Tx_Enable
+        #define EV_Tx_Enable  0
+    #endif
+#elif EV_Config_Profile != EV_Profile_Default
+    #error "EV_Config_Profile must be EV_Profile_Default or EV_Profile_Minimal"
+#endif
+
+
+/* ============================================================================
+ *                         PROJECT OPTIONS
+ * ============================================================================
+ *  Move the options of this project out of the comments and edit their
+ *  values. The #ifndef keeps a compiler flag (-D) in charge of the same
+ *  option. The full description of every option is in ev1527.h and
+ *  API_Reference.md.
+ * ============================================================================ */
+
+/* Frame format and timing */
+/*
+#ifndef EV_Data_Bits
+    #define EV_Data_Bits  24
+#endif
+#ifndef EV_Key_Bits
+    #define EV_Key_Bits  4
+#endif
+#ifndef EV_Timer_Prescaler
+    #define EV_Timer_Prescaler  8
+#endif
+#ifndef EV_Adaptive_T
+    #define EV_Adaptive_T  0
+#endif
+*/
+
+/* Capture and decoding */
+/*
+#ifndef EV_Capture_Mode
+    #define EV_Capture_Mode  EV_Capture_INT0
+#endif
+#ifndef EV_Decode_Mode
+    #define EV_Decode_Mode  EV_Decode_ISR
+#endif
+#ifndef EV_Reception_Mode
+    #define EV_Reception_Mode  EV_Reception_Single
+#endif
+#ifndef EV_Channel_Count
+    #define EV_Channel_Count  1
+#endif
+#ifndef EV_LowPower_Mode
+    #define EV_LowPower_Mode  EV_LowPower_Off
+#endif
+*/
+
+/* Output - SRAM: 5 bytes per queue slot (3 with EV_Data_Bits <= 16), +4 with EV_Stamp_Enable */
+/*
+#ifndef EV_Queue_Enable
+    #define EV_Queue_Enable  1
+#endif
+#ifndef EV_Queue_Size
+    #define EV_Queue_Size  8
+#endif
+#ifndef EV_Callback_Enable
+    #define EV_Callback_Enable  0
+#endif
+*/
+
+/* Multi-protocol table - flash: 12 bytes per protocol, SRAM: its per-channel state */
+/*
+#ifndef EV_Protocol_PT2262
+    #define EV_Protocol_PT2262  0
+#endif
+#ifndef EV_Protocol_HT12E
+    #define EV_Protocol_HT12E  0
+#endif
+*/
+
+/* Filters */
+/*
+#ifndef EV_Confirm_Enable
+    #define EV_Confirm_Enable  0
+#endif
+#ifndef EV_Soft_Enable
+    #define EV_Soft_Enable  0
+#endif
+#ifndef EV_Quality_Enable
+    #define EV_Quality_Enable  0
+#endif
+#ifndef EV_Stamp_Enable
+    #define EV_Stamp_Enable  0
+#endif
+#ifndef EV_Gesture_Enable
+    #define EV_Gesture_Enable  0
+#endif
+#ifndef EV_Whitelist_Enable
+    #define EV_Whitelist_Enable  0
+#endif
+#ifndef EV_Store_Enable
+    #define EV_Store_Enable  0
+#endif
+#ifndef EV_Glitch_Enable
+    #define EV_Glitch_Enable  0
+#endif
+#ifndef EV_Storm_Enable
+    #define EV_Storm_Enable  0
+#endif
+*/
+
+/* Diagnostics and transmitter */
+/*
+#ifndef EV_Raw_Enable
+    #define EV_Raw_Enable  0
+#endif
+#ifndef EV_Stats_Enable
+    #define EV_Stats_Enable  0
+#endif
+#ifndef EV_Bench_Enable
+    #define EV_Bench_Enable  0
+#endif
+#ifndef EV_Bench_Timer0
+    #define EV_Bench_Timer0  0
+#endif
+#ifndef EV_Tx_Enable
+    #define EV_Tx_Enable  0
+#endif
+*/
+
+#endif /* _ev1527_config_H_ */